@@ -20,6 +20,8 @@ limitations under the License.
 
 #include <benchmark/benchmark.h>
 
+#include <memory>
+
 using namespace spapq;
 
 constexpr std::size_t capacity = 1024U;
@@ -89,6 +91,107 @@ static void BM_RingBuffer_1Threads_random(benchmark::State &state) {
 
 BENCHMARK(BM_RingBuffer_1Threads_random)->Arg(numItems)->UseRealTime();
 
+template <std::size_t cap>
+static void BM_RingBuffer_1Threads_alternating_capacity(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+    std::srand(seed);
+
+    RingBuffer<std::size_t, cap> channel;
+
+    std::vector<std::size_t> values(N);
+    for (std::size_t i = 0; i < values.size(); ++i) { values[i] = static_cast<std::size_t>(std::rand()); }
+
+    for (auto _ : state) {
+        std::size_t popVal = 0U;
+        for (std::size_t i = 0U; i < values.size(); ++i) {
+            while (not channel.push(values[i])) { }
+            while (not channel.pop(popVal)) { }
+        }
+        benchmark::DoNotOptimize(popVal);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_RingBuffer_1Threads_alternating_capacity, 1024U)->Arg(numItems)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingBuffer_1Threads_alternating_capacity, 1000U)->Arg(numItems)->UseRealTime();
+
+template <std::size_t cap>
+static void BM_RingBuffer_1Threads_batch_capacity(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+    constexpr std::size_t batch = 7U;
+    std::srand(seed);
+
+    RingBuffer<std::size_t, cap> channel;
+
+    std::vector<std::size_t> values(N);
+    for (std::size_t i = 0; i < values.size(); ++i) { values[i] = static_cast<std::size_t>(std::rand()); }
+    std::vector<std::size_t> out(batch);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0U; i + batch <= values.size(); i += batch) {
+            const auto first = values.cbegin() + static_cast<std::ptrdiff_t>(i);
+            while (not channel.push(first, first + static_cast<std::ptrdiff_t>(batch))) { }
+            std::size_t popped = 0U;
+            while (popped < batch) {
+                popped += channel.pop(out.begin() + static_cast<std::ptrdiff_t>(popped), batch - popped);
+            }
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>((values.size() / batch) * batch) * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_RingBuffer_1Threads_batch_capacity, 1024U)->Arg(numItems)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingBuffer_1Threads_batch_capacity, 1000U)->Arg(numItems)->UseRealTime();
+
+template <std::size_t cap, std::size_t padding>
+static void BM_RingBuffer_1Threads_footprint(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+    const std::size_t numChannels = static_cast<std::size_t>(state.range(1));
+    std::srand(seed);
+
+    using ChannelType = RingBuffer<std::size_t, cap, false, padding>;
+    std::vector<std::unique_ptr<ChannelType>> channels(numChannels);
+    for (auto &channel : channels) { channel = std::make_unique<ChannelType>(); }
+
+    std::vector<std::size_t> values(N);
+    for (std::size_t i = 0; i < values.size(); ++i) { values[i] = static_cast<std::size_t>(std::rand()); }
+
+    for (auto _ : state) {
+        std::size_t popVal = 0U;
+        for (std::size_t i = 0U; i < values.size(); ++i) {
+            ChannelType &channel = *channels[i % numChannels];
+            while (not channel.push(values[i])) { }
+            while (not channel.pop(popVal)) { }
+        }
+        benchmark::DoNotOptimize(popVal);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["BytesPerChannel"] = static_cast<double>(sizeof(ChannelType));
+    state.counters["OverheadPerChannel"]
+        = static_cast<double>(sizeof(ChannelType) - (cap * sizeof(std::size_t)));
+    state.counters["TotalBytes"] = static_cast<double>(sizeof(ChannelType) * numChannels);
+    state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_RingBuffer_1Threads_footprint, 8U, CACHE_LINE_SIZE)
+    ->ArgsProduct({{numItems}, {16, 256}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingBuffer_1Threads_footprint, 8U, alignof(std::size_t))
+    ->ArgsProduct({{numItems}, {16, 256}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingBuffer_1Threads_footprint, 64U, CACHE_LINE_SIZE)
+    ->ArgsProduct({{numItems}, {16, 256}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingBuffer_1Threads_footprint, 64U, alignof(std::size_t))
+    ->ArgsProduct({{numItems}, {16, 256}})
+    ->UseRealTime();
+
 RingBuffer<std::size_t, capacity> *channel_optional;
 std::atomic_flag start_optional;
 std::atomic_flag end_optional;
@@ -187,4 +290,171 @@ static void BM_RingBuffer_2Threads_reference(benchmark::State &state) {
 
 BENCHMARK(BM_RingBuffer_2Threads_reference)->Arg(numItems)->Threads(2)->UseRealTime();
 
+template <std::size_t padding>
+RingBuffer<std::size_t, capacity, false, padding> *channel_padding;
+template <std::size_t padding>
+std::atomic_flag start_padding;
+template <std::size_t padding>
+std::atomic_flag end_padding;
+
+template <std::size_t padding>
+static void BM_RingBuffer_2Threads_padding(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+    std::srand(seed);
+
+    const bool producer = state.thread_index() & 1;
+
+    RingBuffer<std::size_t, capacity, false, padding> chan_pad;
+    if (producer) {
+        start_padding<padding>.wait(false, std::memory_order_acquire);
+    } else {
+        channel_padding<padding> = &chan_pad;
+        start_padding<padding>.test_and_set(std::memory_order_release);
+        start_padding<padding>.notify_all();
+    }
+
+    std::vector<std::size_t> values(N);
+    for (std::size_t i = 0; i < values.size(); ++i) { values[i] = static_cast<std::size_t>(std::rand()); }
+
+    for (auto _ : state) {
+        if (producer) {
+            for (std::size_t i = 0U; i < values.size(); ++i) {
+                while (not channel_padding<padding>->push(values[i])) { }
+            }
+        } else {
+            std::size_t val = 0U;
+            for (std::size_t i = 0U; i < values.size(); ++i) {
+                while (not channel_padding<padding>->pop(val)) { }
+            }
+            benchmark::DoNotOptimize(val);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    if (producer) {
+        end_padding<padding>.test_and_set(std::memory_order_release);
+        end_padding<padding>.notify_all();
+    } else {
+        end_padding<padding>.wait(false, std::memory_order_acquire);
+    }
+
+    state.counters["Padding"] = static_cast<double>(padding);
+    state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_RingBuffer_2Threads_padding, 8U)->Arg(numItems)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingBuffer_2Threads_padding, 32U)->Arg(numItems)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingBuffer_2Threads_padding, 64U)->Arg(numItems)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingBuffer_2Threads_padding, 128U)->Arg(numItems)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingBuffer_2Threads_padding, 256U)->Arg(numItems)->Threads(2)->UseRealTime();
+
+WaitableRingBuffer<std::size_t, capacity> *channel_wait;
+std::atomic_flag start_wait;
+std::atomic_flag end_wait;
+
+static void BM_RingBuffer_2Threads_wait(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+    std::srand(seed);
+
+    const bool producer = state.thread_index() & 1;
+
+    WaitableRingBuffer<std::size_t, capacity> chan_wait;
+    if (producer) {
+        start_wait.wait(false, std::memory_order_acquire);
+    } else {
+        channel_wait = &chan_wait;
+        start_wait.test_and_set(std::memory_order_release);
+        start_wait.notify_all();
+    }
+
+    std::vector<std::size_t> values(N);
+    for (std::size_t i = 0; i < values.size(); ++i) { values[i] = static_cast<std::size_t>(std::rand()); }
+
+    for (auto _ : state) {
+        if (producer) {
+            for (std::size_t i = 0U; i < values.size(); ++i) { channel_wait->pushWait(values[i]); }
+        } else {
+            std::size_t val = 0U;
+            for (std::size_t i = 0U; i < values.size(); ++i) { val = channel_wait->popWait(); }
+            benchmark::DoNotOptimize(val);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    if (producer) {
+        end_wait.test_and_set(std::memory_order_release);
+        end_wait.notify_all();
+    } else {
+        end_wait.wait(false, std::memory_order_acquire);
+    }
+
+    state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+
+BENCHMARK(BM_RingBuffer_2Threads_wait)->Arg(numItems)->Threads(2)->UseRealTime();
+
+RingBuffer<std::size_t, capacity> *channel_streaming;
+std::atomic_flag start_streaming;
+std::atomic_flag end_streaming;
+
+template <bool streaming>
+static void BM_RingBuffer_2Threads_batch_streaming(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+    const std::size_t batch = static_cast<std::size_t>(state.range(1));
+    std::srand(seed);
+
+    const bool producer = state.thread_index() & 1;
+
+    RingBuffer<std::size_t, capacity> chan_stream;
+    if (producer) {
+        start_streaming.wait(false, std::memory_order_acquire);
+    } else {
+        channel_streaming = &chan_stream;
+        start_streaming.test_and_set(std::memory_order_release);
+        start_streaming.notify_all();
+    }
+
+    std::vector<std::size_t> values(N);
+    for (std::size_t i = 0; i < values.size(); ++i) { values[i] = static_cast<std::size_t>(std::rand()); }
+    std::vector<std::size_t> out(capacity);
+
+    for (auto _ : state) {
+        if (producer) {
+            for (std::size_t i = 0U; i + batch <= values.size(); i += batch) {
+                const auto first = values.cbegin() + static_cast<std::ptrdiff_t>(i);
+                const auto last = first + static_cast<std::ptrdiff_t>(batch);
+                if constexpr (streaming) {
+                    while (not channel_streaming->pushStreaming(first, last)) { }
+                } else {
+                    while (not channel_streaming->push(first, last)) { }
+                }
+            }
+        } else {
+            const std::size_t numPushed = (values.size() / batch) * batch;
+            std::size_t popped = 0U;
+            while (popped < numPushed) { popped += channel_streaming->drain(out.begin()); }
+            benchmark::DoNotOptimize(out.data());
+        }
+        benchmark::ClobberMemory();
+    }
+
+    if (producer) {
+        end_streaming.test_and_set(std::memory_order_release);
+        end_streaming.notify_all();
+    } else {
+        end_streaming.wait(false, std::memory_order_acquire);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>((values.size() / batch) * batch) * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_RingBuffer_2Threads_batch_streaming, false)
+    ->ArgsProduct({{numItems}, {16, 32, 64}})
+    ->Threads(2)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingBuffer_2Threads_batch_streaming, true)
+    ->ArgsProduct({{numItems}, {16, 32, 64}})
+    ->Threads(2)
+    ->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -18,9 +18,11 @@ limitations under the License.
 
 #include <benchmark/benchmark.h>
 
+#include <chrono>
 #include <queue>
 #include <vector>
 
+#include "ParallelPriotityQueue/DynamicSpapQueue.hpp"
 #include "ParallelPriotityQueue/GraphExamples/FullyConnectedGraph.hpp"
 #include "ParallelPriotityQueue/GraphExamples/LineGraph.hpp"
 #include "ParallelPriotityQueue/SpapQueue.hpp"
@@ -216,4 +218,238 @@ static void BM_SpapQueue_Fibonacci_8_Workers(benchmark::State &state) {
 
 BENCHMARK(BM_SpapQueue_Fibonacci_8_Workers)->Arg(fibonacciTestSize)->UseRealTime();
 
+template <ChannelKind kind, bool doorbells = false>
+static void BM_SpapQueue_Fibonacci_8_Workers_FullyConnected(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+
+    constexpr QNetwork<8, 64> netw = []() {
+        QNetwork<8, 64> graph = FULLY_CONNECTED_GRAPH<8U>();
+        if (kind == ChannelKind::MPSCRing) { graph.mergeInPorts(); }
+        graph.channelKind_ = kind;
+        graph.portDoorbells_ = doorbells;
+        return graph;
+    }();
+
+    SpapQueue<std::size_t, netw, FibonacciWorker, std::priority_queue<std::size_t>> globalQ;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        globalQ.initQueue();
+        globalQ.pushBeforeProcessing(N, 0U);
+        state.ResumeTiming();
+
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(fibonacciProcessedElements(static_cast<std::size_t>(state.range(0)))
+                            * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_8_Workers_FullyConnected, ChannelKind::SPSCRing)
+    ->Arg(fibonacciTestSize)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_8_Workers_FullyConnected, ChannelKind::MPSCRing)
+    ->Arg(fibonacciTestSize)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_8_Workers_FullyConnected, ChannelKind::SPSCSegmented)
+    ->Arg(fibonacciTestSize)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_8_Workers_FullyConnected, ChannelKind::SPSCRing, true)
+    ->Arg(fibonacciTestSize)
+    ->UseRealTime();
+
+static void BM_DynamicSpapQueue_Fibonacci_8_Workers_FullyConnected(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+
+    DynamicSpapQueue<std::size_t, DynamicFibonacciWorker, std::priority_queue<std::size_t>> globalQ(
+        DYNAMIC_FULLY_CONNECTED_GRAPH(8U));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        globalQ.initQueue();
+        globalQ.pushBeforeProcessing(N, 0U);
+        state.ResumeTiming();
+
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(fibonacciProcessedElements(static_cast<std::size_t>(state.range(0)))
+                            * state.iterations());
+}
+
+BENCHMARK(BM_DynamicSpapQueue_Fibonacci_8_Workers_FullyConnected)->Arg(fibonacciTestSize)->UseRealTime();
+
+template <IdlePolicy policy>
+static void BM_SpapQueue_Fibonacci_8_Workers_IdlePolicy(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+
+    constexpr QNetwork<8, 64> netw = []() {
+        QNetwork<8, 64> graph = FULLY_CONNECTED_GRAPH<8U>();
+        graph.idlePolicy_ = policy;
+        return graph;
+    }();
+
+    SpapQueue<std::size_t, netw, FibonacciWorker, std::priority_queue<std::size_t>> globalQ;
+
+    double idleSeconds = 0.0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        globalQ.initQueue();
+        globalQ.pushBeforeProcessing(N, 0U);
+        state.ResumeTiming();
+
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+
+        benchmark::ClobberMemory();
+
+        state.PauseTiming();
+        for (std::size_t worker = 0U; worker < netw.numWorkers_; ++worker) {
+            idleSeconds += std::chrono::duration<double>(globalQ.idleTime(worker)).count();
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(fibonacciProcessedElements(static_cast<std::size_t>(state.range(0)))
+                            * state.iterations());
+    state.counters["IdleSecondsPerWorker"] = benchmark::Counter(
+        idleSeconds / static_cast<double>(netw.numWorkers_), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_8_Workers_IdlePolicy, IdlePolicy::Spin)
+    ->Arg(fibonacciTestSize)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_8_Workers_IdlePolicy, IdlePolicy::Backoff)
+    ->Arg(fibonacciTestSize)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_8_Workers_IdlePolicy, IdlePolicy::Yield)
+    ->Arg(fibonacciTestSize)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_8_Workers_IdlePolicy, IdlePolicy::Park)
+    ->Arg(fibonacciTestSize)
+    ->UseRealTime();
+
+template <TerminationDetection termination>
+static void BM_SpapQueue_Fibonacci_32_Workers_Termination(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+
+    constexpr QNetwork<32, 1024> netw = []() {
+        QNetwork<32, 1024> graph = FULLY_CONNECTED_GRAPH<32U>();
+        graph.termination_ = termination;
+        return graph;
+    }();
+
+    SpapQueue<std::size_t, netw, FibonacciWorker, std::priority_queue<std::size_t>> globalQ;
+
+    double idleSeconds = 0.0;
+    double countUpdates = 0.0;
+    double tallyPublishes = 0.0;
+    double finishAttempts = 0.0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        globalQ.initQueue();
+        globalQ.pushBeforeProcessing(N, 0U);
+        state.ResumeTiming();
+
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+
+        benchmark::ClobberMemory();
+
+        state.PauseTiming();
+        for (std::size_t worker = 0U; worker < netw.numWorkers_; ++worker) {
+            idleSeconds += std::chrono::duration<double>(globalQ.idleTime(worker)).count();
+
+            const TerminationWrites &writes = globalQ.terminationWrites(worker);
+            countUpdates += static_cast<double>(writes.countUpdates_);
+            tallyPublishes += static_cast<double>(writes.tallyPublishes_);
+            finishAttempts += static_cast<double>(writes.finishAttempts_);
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(fibonacciProcessedElements(static_cast<std::size_t>(state.range(0)))
+                            * state.iterations());
+    state.counters["IdleSecondsPerWorker"] = benchmark::Counter(
+        idleSeconds / static_cast<double>(netw.numWorkers_), benchmark::Counter::kAvgIterations);
+    state.counters["CountUpdates"] = benchmark::Counter(countUpdates, benchmark::Counter::kAvgIterations);
+    state.counters["TallyPublishes"] = benchmark::Counter(tallyPublishes, benchmark::Counter::kAvgIterations);
+    state.counters["FinishAttempts"] = benchmark::Counter(finishAttempts, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_32_Workers_Termination, TerminationDetection::GlobalCount)
+    ->Arg(fibonacciTestSize)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_32_Workers_Termination, TerminationDetection::Quiescence)
+    ->Arg(fibonacciTestSize)
+    ->UseRealTime();
+
+template <bool persistent>
+static void BM_SpapQueue_Fibonacci_8_Workers_Restart(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+
+    constexpr QNetwork<8, 64> netw = []() {
+        QNetwork<8, 64> graph = FULLY_CONNECTED_GRAPH<8U>();
+        graph.persistentWorkers_ = persistent;
+        return graph;
+    }();
+
+    SpapQueue<std::size_t, netw, FibonacciWorker, std::priority_queue<std::size_t>> globalQ;
+
+    // Each iteration is a whole run including the start-up and tear-down of the workers
+    for (auto _ : state) {
+        globalQ.initQueue();
+        globalQ.pushBeforeProcessing(N, 0U);
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(fibonacciProcessedElements(static_cast<std::size_t>(state.range(0)))
+                            * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_8_Workers_Restart, false)->Arg(1)->Arg(12)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_8_Workers_Restart, true)->Arg(1)->Arg(12)->UseRealTime();
+
+template <std::size_t workers, bool staticDispatch>
+static void BM_SpapQueue_Fibonacci_Dispatch(benchmark::State &state) {
+    const std::size_t N = static_cast<std::size_t>(state.range(0));
+
+    constexpr QNetwork<workers, workers * workers> netw = []() {
+        QNetwork<workers, workers * workers> graph = FULLY_CONNECTED_GRAPH<workers>();
+        graph.staticDispatch_ = staticDispatch;
+        return graph;
+    }();
+
+    SpapQueue<std::size_t, netw, FibonacciWorker, std::priority_queue<std::size_t>> globalQ;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        globalQ.initQueue();
+        globalQ.pushBeforeProcessing(N, 0U);
+        state.ResumeTiming();
+
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(fibonacciProcessedElements(static_cast<std::size_t>(state.range(0)))
+                            * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_Dispatch, 1U, false)->Arg(fibonacciTestSize)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_Dispatch, 1U, true)->Arg(fibonacciTestSize)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_Dispatch, 8U, false)->Arg(fibonacciTestSize)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SpapQueue_Fibonacci_Dispatch, 8U, true)->Arg(fibonacciTestSize)->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -24,9 +24,12 @@ limitations under the License.
 #include <limits>
 #include <queue>
 #include <random>
+#include <vector>
 
+#include "ParallelPriotityQueue/DynamicSpapQueue.hpp"
 #include "ParallelPriotityQueue/GraphExamples/FullyConnectedGraph.hpp"
 #include "ParallelPriotityQueue/GraphExamples/LineGraph.hpp"
+#include "ParallelPriotityQueue/GraphExamples/TopologyGraph.hpp"
 #include "ParallelPriotityQueue/SpapQueue.hpp"
 #include "ParallelPriotityQueue/WorkerExamples/SSSPWorker.hpp"
 
@@ -334,4 +337,117 @@ static void BM_SpapQueue_SSSP_8_Workers(benchmark::State &state) {
 
 BENCHMARK(BM_SpapQueue_SSSP_8_Workers)->Args({numVertices_, edgesPerVertex_, seedNumber_})->UseRealTime();
 
+/**
+ * @brief Fully connected network in which the workers 2i and 2i+1 form a pair, linked by the channels used for
+ * SMT siblings in TOPOLOGY_AWARE_GRAPH. All other channels use large batches.
+ *
+ */
+DynamicQNetwork pairedNetwork(const std::vector<std::size_t> &cores) {
+    const TopologyGraphParameters params;
+    const std::size_t numWorkers = cores.size();
+
+    std::vector<std::size_t> vertexPtr(numWorkers + 1U);
+    std::vector<std::size_t> edges;
+    std::vector<std::size_t> multiplicities;
+    std::vector<std::size_t> batchSizes;
+
+    for (std::size_t worker = 0U; worker < numWorkers; ++worker) {
+        vertexPtr[worker] = edges.size();
+        for (std::size_t i = 0U; i < numWorkers; ++i) {
+            const std::size_t target = (worker + i) % numWorkers;
+            edges.push_back(target);
+            if (target == worker) {
+                multiplicities.push_back(params.intraNodeMultiplicity_);
+                batchSizes.push_back(params.intraNodeBatchSize_);
+            } else if (target / 2U == worker / 2U) {
+                multiplicities.push_back(params.smtSiblingMultiplicity_);
+                batchSizes.push_back(params.smtSiblingBatchSize_);
+            } else {
+                multiplicities.push_back(1U);
+                batchSizes.push_back(params.intraNodeBatchSize_ * 2U);
+            }
+        }
+    }
+    vertexPtr[numWorkers] = edges.size();
+
+    return DynamicQNetwork(
+        std::move(vertexPtr), std::move(edges), cores, std::move(multiplicities), std::move(batchSizes));
+}
+
+/**
+ * @brief Runs the same paired network on the same CPUs, i.e., the first two hardware threads of range(3)
+ * physical cores. The partners of a pair are either SMT siblings, sharing L1 and L2, or on neighbouring
+ * physical cores.
+ *
+ */
+template <bool siblingPaired>
+static void BM_DynamicSpapQueue_SSSP_SMT_Pairs(benchmark::State &state) {
+    const std::size_t numPairs = static_cast<std::size_t>(state.range(3));
+
+    const CpuTopology topology = CpuTopology::fromSysfs();
+    std::vector<std::array<std::size_t, 2U>> smtCores;
+    for (std::size_t i = 0U; i + 1U < topology.numCpus(); ++i) {
+        const LogicalCpu &cpu = topology.cpus()[i];
+        const LogicalCpu &next = topology.cpus()[i + 1U];
+        if (topology.areSmtSiblings(cpu.cpu_, next.cpu_)
+            && (smtCores.empty() || (not topology.areSmtSiblings(smtCores.back()[0U], cpu.cpu_)))) {
+            smtCores.push_back({cpu.cpu_, next.cpu_});
+        }
+    }
+    if (smtCores.size() < std::max(numPairs, std::size_t{2U})) {
+        state.SkipWithError("Requires as many physical cores with at least two hardware threads as pairs.");
+        return;
+    }
+
+    std::vector<std::size_t> cores(2U * numPairs);
+    for (std::size_t pair = 0U; pair < numPairs; ++pair) {
+        cores[2U * pair] = smtCores[pair][0U];
+        cores[2U * pair + 1U] = siblingPaired ? smtCores[pair][1U] : smtCores[(pair + 1U) % numPairs][1U];
+    }
+
+    DynamicSpapQueue<std::array<unsigned, 2U>,
+                     DynamicSSSPWorker,
+                     std::priority_queue<std::array<unsigned, 2U>,
+                                         std::vector<std::array<unsigned, 2U>>,
+                                         std::greater<std::array<unsigned, 2U>>>>
+        globalQ(pairedNetwork(cores));
+
+    const unsigned nVerts = static_cast<unsigned>(state.range(0));
+    const unsigned ePerVerts = static_cast<unsigned>(state.range(1));
+    const std::size_t seed = static_cast<std::size_t>(state.range(2));
+
+    const CSRGraph graph = makeGraph(nVerts, ePerVerts, seed);
+    std::vector<std::atomic<unsigned>> distances(nVerts);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+
+        for (auto &dist : distances) {
+            dist.store(std::numeric_limits<unsigned>::max(), std::memory_order_relaxed);
+        }
+        distances[0].store(0U, std::memory_order_relaxed);
+
+        globalQ.initQueue(std::cref(graph), std::ref(distances));
+        globalQ.pushBeforeProcessing({0, 0}, 0U);
+
+        state.ResumeTiming();
+
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.range(0) * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_DynamicSpapQueue_SSSP_SMT_Pairs, true)
+    ->Args({numVertices_, edgesPerVertex_, seedNumber_, 2})
+    ->Args({numVertices_, edgesPerVertex_, seedNumber_, 4})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_DynamicSpapQueue_SSSP_SMT_Pairs, false)
+    ->Args({numVertices_, edgesPerVertex_, seedNumber_, 2})
+    ->Args({numVertices_, edgesPerVertex_, seedNumber_, 4})
+    ->UseRealTime();
+
 BENCHMARK_MAIN();
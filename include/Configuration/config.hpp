@@ -18,15 +18,22 @@ limitations under the License.
 
 #pragma once
 
+#include <bit>
 #include <cstddef>
 #include <new>
 
 namespace spapq {
 
-#ifdef __cpp_lib_hardware_interference_size
+// The granularity of false sharing may be set at build time, e.g. to 128 on machines whose adjacent-line
+// prefetcher pulls in pairs of cache lines.
+#if defined(SPAPQ_CACHE_LINE_SIZE)
+static constexpr std::size_t CACHE_LINE_SIZE = SPAPQ_CACHE_LINE_SIZE;
+#elif defined(__cpp_lib_hardware_interference_size)
 static constexpr std::size_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size;
 #else
 static constexpr std::size_t CACHE_LINE_SIZE = 64U;
 #endif
 
+static_assert(std::has_single_bit(CACHE_LINE_SIZE), "Cache line size needs to be a power of two!\n");
+
 }        // end namespace spapq
@@ -19,6 +19,7 @@ limitations under the License.
 #pragma once
 
 #include "Discrepancy/TableGenerator.hpp"
+#include "ParallelPriotityQueue/DynamicQNetwork.hpp"
 #include "ParallelPriotityQueue/QNetwork.hpp"
 
 namespace spapq {
@@ -129,5 +130,47 @@ constexpr std::size_t maxTableSize() {
     return maxTableSizeHelper<netw, netw.numWorkers_>();
 }
 
+/**
+ * @brief Run-time counterpart of qNetworkTableFrequencies for a DynamicQNetwork.
+ *
+ * @param netw Valid DynamicQNetwork.
+ * @param workerId Worker.
+ *
+ * @see qNetworkTableFrequencies
+ */
+inline std::vector<std::size_t> qNetworkTableFrequencies(const DynamicQNetwork &netw, const std::size_t workerId) {
+    assert(netw.isValidQNetwork());
+    assert(workerId < netw.numWorkers_);
+
+    std::size_t batchSizeLCM = 1;
+    for (std::size_t i = netw.vertexPointer_[workerId]; i < netw.vertexPointer_[workerId + 1]; ++i) {
+        batchSizeLCM = std::lcm(batchSizeLCM, netw.batchSize_[i]);
+    }
+
+    std::vector<std::size_t> frequencies(netw.outDegree(workerId));
+    for (std::size_t i = netw.vertexPointer_[workerId]; i < netw.vertexPointer_[workerId + 1]; ++i) {
+        const std::size_t index = i - netw.vertexPointer_[workerId];
+        frequencies[index] = netw.multiplicities_[i] * (batchSizeLCM / netw.batchSize_[i]);
+    }
+
+    return reducedIntegerArray(frequencies);
+}
+
+/**
+ * @brief Run-time counterpart of qNetworkTable for a DynamicQNetwork, computed when the queue is built.
+ *
+ * @param netw Valid DynamicQNetwork.
+ * @param workerId Worker.
+ *
+ * @see qNetworkTable
+ */
+inline std::vector<std::size_t> qNetworkTable(const DynamicQNetwork &netw, const std::size_t workerId) {
+    std::vector<std::size_t> table = earliestDeadlineFirstTable(qNetworkTableFrequencies(netw, workerId));
+
+    for (std::size_t &val : table) { val += netw.vertexPointer_[workerId]; }
+
+    return table;
+}
+
 }        // end namespace tables
 }        // end namespace spapq
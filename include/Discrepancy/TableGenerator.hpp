@@ -23,21 +23,22 @@ limitations under the License.
 #include <cassert>
 #include <limits>
 #include <numeric>
+#include <vector>
 
 namespace spapq {
 namespace tables {
 
 /**
- * @brief Divides each entry of the array by the gcd of the whole array. If all entries are zero, it returns
- * the original array.
+ * @brief Divides each entry of the container by the gcd of all entries. If all entries are zero, it returns
+ * the original container.
  *
  */
-template <std::size_t N>
-constexpr std::array<std::size_t, N> reducedIntegerArray(const std::array<std::size_t, N> &arr) {
+template <class Container>
+constexpr Container reducedIntegers(const Container &arr) {
     std::size_t commonGCD = 0U;
     for (const std::size_t &val : arr) { commonGCD = std::gcd(commonGCD, val); }
 
-    std::array<std::size_t, N> reducedArr = arr;
+    Container reducedArr = arr;
     if (commonGCD > 0U) {
         for (std::size_t &val : reducedArr) { val /= commonGCD; }
     }
@@ -45,6 +46,25 @@ constexpr std::array<std::size_t, N> reducedIntegerArray(const std::array<std::s
     return reducedArr;
 };
 
+/**
+ * @brief Divides each entry of the array by the gcd of the whole array. If all entries are zero, it returns
+ * the original array.
+ *
+ */
+template <std::size_t N>
+constexpr std::array<std::size_t, N> reducedIntegerArray(const std::array<std::size_t, N> &arr) {
+    return reducedIntegers(arr);
+};
+
+/**
+ * @brief Divides each entry of the vector by the gcd of the whole vector. If all entries are zero, it returns
+ * the original vector.
+ *
+ */
+inline std::vector<std::size_t> reducedIntegerArray(const std::vector<std::size_t> &arr) {
+    return reducedIntegers(arr);
+};
+
 /**
  * @brief Sums all elements of the array.
  *
@@ -80,31 +100,28 @@ constexpr std::size_t findEarliestdeadline(
 }
 
 /**
- * @brief Compute a so-called table, which is a series (array) A such that for N = 0,...,tableSize and for
- * s=0,...,M-1, we have that |#{n in [0,N[ | A[n] == s} - frequencies[s] * N / tableSize| is bounded by 1 (in
- * infinite precision).
+ * @brief Fills table with the earliest deadline first table of the frequencies. Shared by the compile-time and
+ * the run-time variant, the containers merely need to be indexable and of the right size.
  *
- * @tparam M Size of the array frequencies.
- * @tparam tableSize Sum of the entries in frequencies, which the size of the output table.
- * @param frequencies The value frequencies[i] marks the number of occurences of i inside the table
+ * @param frequencies The value frequencies[i] marks the number of occurences of i inside the table.
+ * @param table Output, whose size is the sum of the entries in frequencies.
+ *
+ * @see earliestDeadlineFirstTable
  */
-template <std::size_t M, std::size_t tableSize>
-constexpr std::array<std::size_t, tableSize> earliestDeadlineFirstTable(
-    const std::array<std::size_t, M> &frequencies) {
-    static_assert(tableSize <= (std::numeric_limits<std::size_t>::max() >> ((sizeof(std::size_t) * 4U) + 1U)),
-                  "May overflow if this condition is not met!");
+template <class FrequencyContainer, class TableContainer>
+constexpr void fillEarliestDeadlineFirstTable(const FrequencyContainer &frequencies, TableContainer &table) {
+    const std::size_t tableSize = table.size();
+    assert(tableSize <= (std::numeric_limits<std::size_t>::max() >> ((sizeof(std::size_t) * 4U) + 1U)));
     assert(tableSize
            == std::accumulate(frequencies.cbegin(), frequencies.cend(), static_cast<std::size_t>(0U)));
     assert(std::all_of(
         frequencies.cbegin(), frequencies.cend(), [](const std::size_t &freq) { return (freq != 0U); }));
 
-    std::array<std::size_t, tableSize> table;
-
-    std::array<std::size_t, M> numAllocs;
+    FrequencyContainer numAllocs = frequencies;
     for (std::size_t i = 0U; i < numAllocs.size(); ++i) { numAllocs[i] = 0U; }
 
-    for (std::size_t i = 0U; i < table.size(); ++i) {
-        constexpr std::size_t limit = table.size() * 2U;
+    for (std::size_t i = 0U; i < tableSize; ++i) {
+        const std::size_t limit = tableSize * 2U;
         std::size_t u = limit;
 
         for (std::size_t s = 0U; s < numAllocs.size(); ++s) {
@@ -119,6 +136,38 @@ constexpr std::array<std::size_t, tableSize> earliestDeadlineFirstTable(
         }
         ++numAllocs[table[i]];
     }
+}
+
+/**
+ * @brief Compute a so-called table, which is a series (array) A such that for N = 0,...,tableSize and for
+ * s=0,...,M-1, we have that |#{n in [0,N[ | A[n] == s} - frequencies[s] * N / tableSize| is bounded by 1 (in
+ * infinite precision).
+ *
+ * @tparam M Size of the array frequencies.
+ * @tparam tableSize Sum of the entries in frequencies, which the size of the output table.
+ * @param frequencies The value frequencies[i] marks the number of occurences of i inside the table
+ */
+template <std::size_t M, std::size_t tableSize>
+constexpr std::array<std::size_t, tableSize> earliestDeadlineFirstTable(
+    const std::array<std::size_t, M> &frequencies) {
+    static_assert(tableSize <= (std::numeric_limits<std::size_t>::max() >> ((sizeof(std::size_t) * 4U) + 1U)),
+                  "May overflow if this condition is not met!");
+
+    std::array<std::size_t, tableSize> table;
+    fillEarliestDeadlineFirstTable(frequencies, table);
+
+    return table;
+};
+
+/**
+ * @brief Run-time variant of the earliest deadline first table, whose size is the sum of the frequencies.
+ *
+ * @param frequencies The value frequencies[i] marks the number of occurences of i inside the table
+ */
+inline std::vector<std::size_t> earliestDeadlineFirstTable(const std::vector<std::size_t> &frequencies) {
+    std::vector<std::size_t> table(
+        std::accumulate(frequencies.cbegin(), frequencies.cend(), static_cast<std::size_t>(0U)));
+    fillEarliestDeadlineFirstTable(frequencies, table);
 
     return table;
 };
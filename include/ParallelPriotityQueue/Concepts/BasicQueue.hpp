@@ -24,6 +24,12 @@ limitations under the License.
 
 namespace spapq {
 
+/**
+ * @brief A local queue of a worker. If top() hands out a reference, the worker moves the task out of that
+ * reference right before calling pop(), so pop() must not read the moved-from top element. This holds for heap
+ * based queues such as std::priority_queue, which only move the top to the back before discarding it.
+ *
+ */
 template <typename T>
 concept BasicQueue = requires { typename std::remove_cvref_t<T>::value_type; }
                      && requires (std::remove_cvref_t<T> queue, std::remove_cvref_t<T>::value_type obj) {
@@ -32,7 +38,7 @@ concept BasicQueue = requires { typename std::remove_cvref_t<T>::value_type; }
                             queue.push(obj);
                             {
                                 queue.top()
-                            } -> std::convertible_to<typename std::remove_cvref_t<T>::value_type>;
+                            } -> std::convertible_to<const typename std::remove_cvref_t<T>::value_type &>;
                             queue.pop();
                         };
 
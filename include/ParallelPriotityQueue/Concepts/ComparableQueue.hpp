@@ -0,0 +1,41 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+namespace spapq {
+
+/**
+ * @brief A local queue exposing the ordering of its elements through a default constructible value_compare,
+ * with the top being a maximal element with respect to it (as for std::priority_queue).
+ *
+ */
+template <typename T>
+concept ComparableQueue = requires {
+                              typename std::remove_cvref_t<T>::value_type;
+                              typename std::remove_cvref_t<T>::value_compare;
+                          }
+                          && std::default_initializable<typename std::remove_cvref_t<T>::value_compare>
+                          && std::predicate<const typename std::remove_cvref_t<T>::value_compare &,
+                                            const typename std::remove_cvref_t<T>::value_type &,
+                                            const typename std::remove_cvref_t<T>::value_type &>;
+
+}        // end namespace spapq
@@ -0,0 +1,39 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace spapq {
+
+/**
+ * @brief A task which can be written to and read back from a variable-length byte record. serialise is
+ * handed exactly serialisedSize() bytes.
+ *
+ */
+template <typename T>
+concept SerialisableTask = requires (const T &task, std::span<std::byte> out, std::span<const std::byte> in) {
+    { task.serialisedSize() } -> std::convertible_to<std::size_t>;
+    task.serialise(out);
+    { T::deserialise(in) } -> std::convertible_to<T>;
+};
+
+}        // end namespace spapq
@@ -0,0 +1,113 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "Configuration/config.hpp"
+
+namespace spapq {
+
+/**
+ * @brief A bitmap of the ports of a worker which have pending data. Producers ring the bell of a port after
+ * publishing to it and the consumer answers by clearing the bitmap and draining only the rung ports, such that
+ * polling costs are proportional to the number of active ports rather than the in-degree.
+ * Every ring is a sequentially consistent read-modify-write which the clearing exchange of the consumer
+ * synchronises with, hence a port rung after a push is never answered without the pushed data being visible.
+ * Being sequentially consistent, the ring also orders the push before any later sequentially consistent load
+ * of the producer, such as the check for parked workers.
+ *
+ * @tparam numPorts Number of ports.
+ * @tparam padding Alignment of the bitmap, which keeps the bells of different workers apart.
+ */
+template <std::size_t numPorts, std::size_t padding = CACHE_LINE_SIZE>
+class alignas(padding) Doorbell {
+  private:
+    static constexpr std::size_t bitsPerWord_ = 64U;
+
+    std::array<std::atomic<std::uint64_t>, (numPorts + bitsPerWord_ - 1U) / bitsPerWord_> words_{};
+
+  public:
+    Doorbell() = default;
+    Doorbell(const Doorbell &other) = delete;
+    Doorbell(Doorbell &&other) = delete;
+    Doorbell &operator=(const Doorbell &other) = delete;
+    Doorbell &operator=(Doorbell &&other) = delete;
+    ~Doorbell() = default;
+
+    inline void ring(const std::size_t port) noexcept;
+    inline bool rung() const noexcept;
+    template <class PortHandler>
+    inline void answer(PortHandler &&handler) noexcept;
+
+    // assertions
+    static_assert(std::has_single_bit(padding) && padding >= alignof(std::atomic<std::uint64_t>),
+                  "Padding needs to be a power of two and at least the alignment of the bitmap words!\n");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Want atomic to be lock free.\n");
+};
+
+// Implementation details
+
+/**
+ * @brief Marks port as having pending data. To be called after the data has been published.
+ *
+ */
+template <std::size_t numPorts, std::size_t padding>
+inline void Doorbell<numPorts, padding>::ring(const std::size_t port) noexcept {
+    const std::uint64_t bit = std::uint64_t{1U} << (port % bitsPerWord_);
+    words_[port / bitsPerWord_].fetch_or(bit, std::memory_order_seq_cst);
+}
+
+/**
+ * @brief Checks whether any port has been rung and not yet answered.
+ *
+ */
+template <std::size_t numPorts, std::size_t padding>
+inline bool Doorbell<numPorts, padding>::rung() const noexcept {
+    for (const std::atomic<std::uint64_t> &word : words_) {
+        if (word.load(std::memory_order_seq_cst) != 0U) { return true; }
+    }
+    return false;
+}
+
+/**
+ * @brief Clears the bitmap and calls handler with every port which has been rung, in increasing order. Only
+ * to be called by the consumer.
+ *
+ * @param handler Callable taking the port as std::size_t.
+ */
+template <std::size_t numPorts, std::size_t padding>
+template <class PortHandler>
+inline void Doorbell<numPorts, padding>::answer(PortHandler &&handler) noexcept {
+    for (std::size_t wordIndx = 0U; wordIndx < words_.size(); ++wordIndx) {
+        if (words_[wordIndx].load(std::memory_order_relaxed) == 0U) { continue; }
+
+        std::uint64_t bits = words_[wordIndx].exchange(0U, std::memory_order_acquire);
+        while (bits != 0U) {
+            handler(wordIndx * bitsPerWord_ + static_cast<std::size_t>(std::countr_zero(bits)));
+            bits &= bits - 1U;
+        }
+    }
+}
+
+}        // end namespace spapq
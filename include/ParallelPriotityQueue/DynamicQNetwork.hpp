@@ -0,0 +1,501 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ParallelPriotityQueue/QNetwork.hpp"
+
+namespace spapq {
+
+/**
+ * @brief A QNetwork whose number of workers and channels is only known at run time, such that a single binary
+ * can size its queue to the machine it runs on. The network CSR lives on the heap. Only the options supported
+ * by the DynamicSpapQueue are present, i.e., its channels are always SPSCRing channels.
+ *
+ * @see QNetwork
+ * @see DynamicSpapQueue
+ */
+struct DynamicQNetwork {
+    std::size_t numWorkers_;               ///< Number of workers processing the queue.
+    std::size_t numChannels_;              ///< Total number of channels between workers in the queue.
+    std::size_t enqueueFrequency_;         ///< Number of tasks after which workers check incomming channels.
+    std::size_t channelBufferSize_;        ///< Size or capacity of the RingBuffer channels.
+    std::size_t maxPushAttempts_;          ///< Number of attempts to push to over channels before pushing to
+                                           ///< self.
+    std::vector<std::size_t> vertexPointer_;        ///< Vertex pointer in network CSR.
+    std::vector<std::size_t> numPorts_;             ///< Number of incomming channels of worker.
+    std::vector<std::size_t> logicalCore_;          ///< Pthread core number of worker.
+    std::vector<std::size_t> edgeTargets_;          ///< Target worker of channel in network CSR. The number
+                                                    ///< "numWorkers_" is reserved for efficient self-push.
+    std::vector<std::size_t> multiplicities_;        ///< How often this channel should be preferred to push
+                                                     ///< work over other outgoing channels of the same
+                                                     ///< worker.
+    std::vector<std::size_t> targetPort_;        ///< Local index of channel of receiving worker.
+    std::vector<std::size_t> batchSize_;         ///< Number of tasks to be pushed over a channel in one go.
+    CorePinning corePinning_{CorePinning::Remap};        ///< How the workers are pinned to logicalCore_.
+
+    inline std::size_t outDegree(std::size_t worker) const noexcept;
+    inline std::size_t inDegree(std::size_t worker) const noexcept;
+
+    inline std::size_t source(std::size_t channel) const noexcept;
+    inline std::size_t target(std::size_t channel) const noexcept;
+
+    void setDefaultMultiplicities();
+    void setDefaultBatchSize();
+    void setDefaultChannelBufferSize();
+    void setDefaultMaxPushAttempts();
+    void setDefaultLogicalCores();
+    void setDefaultEnqueueFrequency();
+    void roundUpChannelBufferSize();
+
+    void assignTargetPorts();
+    void changeToSelfPushLabels();
+
+    bool hasPathToAllWorkers(std::size_t worker) const;
+    bool isStronglyConnected() const;
+    bool hasConsistentSizes() const;
+    bool isValidQNetwork() const;
+
+    std::size_t maxBatchSize() const;
+    std::size_t maxPortNum() const;
+
+    bool hasSeparateLogicalCores() const;
+
+    void printQNetwork() const;
+
+    DynamicQNetwork(std::vector<std::size_t> vertexPointer,
+                    std::vector<std::size_t> edgeTargets,
+                    std::vector<std::size_t> logicalCore,
+                    std::vector<std::size_t> multiplicities,
+                    std::vector<std::size_t> batchSize,
+                    std::size_t enqueueFrequency,
+                    std::size_t channelBufferSize,
+                    std::size_t maxPushAttempts);
+
+    DynamicQNetwork(std::vector<std::size_t> vertexPointer,
+                    std::vector<std::size_t> edgeTargets,
+                    std::vector<std::size_t> logicalCore,
+                    std::vector<std::size_t> multiplicities,
+                    std::vector<std::size_t> batchSize);
+
+    DynamicQNetwork(std::vector<std::size_t> vertexPointer,
+                    std::vector<std::size_t> edgeTargets,
+                    std::vector<std::size_t> logicalCore,
+                    std::vector<std::size_t> multiplicities);
+
+    DynamicQNetwork(std::vector<std::size_t> vertexPointer,
+                    std::vector<std::size_t> edgeTargets,
+                    std::vector<std::size_t> logicalCore);
+
+    DynamicQNetwork(std::vector<std::size_t> vertexPointer, std::vector<std::size_t> edgeTargets);
+
+    template <std::size_t workers, std::size_t channels>
+    explicit DynamicQNetwork(const QNetwork<workers, channels> &netw);
+};
+
+// Implementation details
+
+inline std::size_t DynamicQNetwork::outDegree(std::size_t worker) const noexcept {
+    const std::size_t degree = vertexPointer_.at(worker + 1U) - vertexPointer_.at(worker);
+    return degree;
+}
+
+inline std::size_t DynamicQNetwork::inDegree(std::size_t worker) const noexcept { return numPorts_.at(worker); }
+
+/**
+ * @brief Returns the source/producer worker of the channel.
+ *
+ */
+inline std::size_t DynamicQNetwork::source(std::size_t channel) const noexcept {
+    auto it = std::upper_bound(vertexPointer_.cbegin(), vertexPointer_.cend(), channel);
+    std::size_t src = static_cast<std::size_t>(std::distance(vertexPointer_.cbegin(), it) - 1);
+    return src;
+}
+
+/**
+ * @brief Returns the target/consumer worker of the channel.
+ *
+ */
+inline std::size_t DynamicQNetwork::target(std::size_t channel) const noexcept {
+    std::size_t tgt = edgeTargets_.at(channel);
+    if (tgt == numWorkers_) { tgt = source(channel); }
+    return tgt;
+}
+
+inline void DynamicQNetwork::setDefaultMultiplicities() { multiplicities_.assign(numChannels_, 1U); }
+
+inline void DynamicQNetwork::setDefaultBatchSize() { batchSize_.assign(numChannels_, 1U); }
+
+inline void DynamicQNetwork::setDefaultEnqueueFrequency() {
+    const std::size_t numWorkersMininum1 = std::max(numWorkers_, static_cast<std::size_t>(1U));
+    const std::size_t avgChannelNum = (numChannels_ + numWorkersMininum1 - 1U) / numWorkersMininum1;
+
+    std::size_t pow2 = 1U;
+    while (pow2 != 0U && pow2 < avgChannelNum) { pow2 *= 2U; }
+
+    enqueueFrequency_ = std::max(static_cast<std::size_t>(16U), pow2 * 2U);
+}
+
+inline void DynamicQNetwork::setDefaultChannelBufferSize() {
+    channelBufferSize_ = std::max(maxBatchSize() * 8U, enqueueFrequency_ * 4U);
+}
+
+/**
+ * @brief Rounds the channel buffer size up to the next power of two, so that the channels can use mask
+ * instead of modulo arithmetic.
+ *
+ */
+inline void DynamicQNetwork::roundUpChannelBufferSize() { channelBufferSize_ = std::bit_ceil(channelBufferSize_); }
+
+inline void DynamicQNetwork::setDefaultMaxPushAttempts() { maxPushAttempts_ = 4U; }
+
+inline void DynamicQNetwork::setDefaultLogicalCores() {
+    logicalCore_.resize(numWorkers_);
+    for (std::size_t i = 0U; i < logicalCore_.size(); ++i) { logicalCore_[i] = i; }
+}
+
+/**
+ * @brief Assigns the ports in the order of the network CSR. Targets out of range are left for
+ * isValidQNetwork to reject.
+ *
+ */
+inline void DynamicQNetwork::assignTargetPorts() {
+    numPorts_.assign(numWorkers_, 0U);
+    targetPort_.assign(numChannels_, 0U);
+    if (not hasConsistentSizes()) { return; }
+
+    for (std::size_t worker = 0U; worker < numWorkers_; ++worker) {
+        for (std::size_t edge = vertexPointer_[worker]; edge < vertexPointer_[worker + 1U]; ++edge) {
+            if (edgeTargets_[edge] == numWorkers_ || edgeTargets_[edge] == worker) {
+                targetPort_[edge] = numPorts_[worker]++;
+            } else if (edgeTargets_[edge] < numWorkers_) {
+                targetPort_[edge] = numPorts_[edgeTargets_[edge]]++;
+            }
+        }
+    }
+}
+
+inline void DynamicQNetwork::changeToSelfPushLabels() {
+    if (not hasConsistentSizes()) { return; }
+
+    for (std::size_t worker = 0U; worker < numWorkers_; ++worker) {
+        for (std::size_t edge = vertexPointer_[worker]; edge < vertexPointer_[worker + 1U]; ++edge) {
+            if (edgeTargets_[edge] == worker) { edgeTargets_[edge] = numWorkers_; }
+        }
+    }
+}
+
+inline bool DynamicQNetwork::hasPathToAllWorkers(std::size_t worker) const {
+    std::vector<bool> reachable(numWorkers_, false);
+    for (std::size_t channel = vertexPointer_.at(worker); channel < vertexPointer_.at(worker + 1U); ++channel) {
+        const std::size_t tgt = edgeTargets_[channel] == numWorkers_ ? worker : edgeTargets_[channel];
+        reachable[tgt] = true;
+    }
+
+    bool hasChanged = true;
+    while (hasChanged) {
+        hasChanged = false;
+
+        for (std::size_t w = 0U; w < numWorkers_; ++w) {
+            if (!reachable[w]) { continue; }
+
+            for (std::size_t channel = vertexPointer_[w]; channel < vertexPointer_[w + 1U]; ++channel) {
+                const std::size_t tgt = edgeTargets_[channel] == numWorkers_ ? w : edgeTargets_[channel];
+                if (reachable[tgt]) { continue; }
+
+                reachable[tgt] = true;
+                hasChanged = true;
+            }
+        }
+    }
+
+    return std::all_of(reachable.cbegin(), reachable.cend(), [](bool val) { return val; });
+}
+
+inline bool DynamicQNetwork::isStronglyConnected() const {
+    for (std::size_t worker = 0U; worker < numWorkers_; ++worker) {
+        if (not hasPathToAllWorkers(worker)) { return false; }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks the invariants which the compile-time QNetwork gets from its array types, i.e., that all
+ * vectors match the number of workers and channels and that the vertex pointer describes a CSR.
+ *
+ */
+inline bool DynamicQNetwork::hasConsistentSizes() const {
+    if (vertexPointer_.size() != numWorkers_ + 1U) { return false; }
+    if (numPorts_.size() != numWorkers_) { return false; }
+    if (logicalCore_.size() != numWorkers_) { return false; }
+    if (edgeTargets_.size() != numChannels_) { return false; }
+    if (multiplicities_.size() != numChannels_) { return false; }
+    if (targetPort_.size() != numChannels_) { return false; }
+    if (batchSize_.size() != numChannels_) { return false; }
+
+    if (vertexPointer_.front() != 0U) { return false; }
+    if (vertexPointer_.back() != numChannels_) { return false; }
+    if (not std::is_sorted(vertexPointer_.cbegin(), vertexPointer_.cend())) { return false; }
+
+    return true;
+}
+
+/**
+ * @brief Run-time counterpart of QNetwork::isValidQNetwork. Additionally checks the sizes of the network CSR,
+ * which the compile-time network fixes through its types.
+ *
+ */
+inline bool DynamicQNetwork::isValidQNetwork() const {
+    if (numWorkers_ == 0U) { return false; }
+    if (numChannels_ == 0U) { return false; }
+    if (not hasConsistentSizes()) { return false; }
+
+    if (not std::all_of(edgeTargets_.cbegin(), edgeTargets_.cend(), [this](const std::size_t &tgt) {
+            return tgt <= numWorkers_;
+        })) {
+        return false;
+    }
+
+    if (not std::all_of(multiplicities_.cbegin(), multiplicities_.cend(), [](const std::size_t &mul) {
+            return mul > 0U;
+        })) {
+        return false;
+    }
+
+    if (not std::all_of(
+            batchSize_.cbegin(), batchSize_.cend(), [](const std::size_t &batch) { return batch > 0U; })) {
+        return false;
+    }
+
+    if (not std::all_of(
+            numPorts_.cbegin(), numPorts_.cend(), [](const std::size_t &ports) { return ports > 0U; })) {
+        return false;
+    }
+
+    // Every port is fed by exactly one channel, as SPSCRing channels do not allow shared ports
+    std::vector<std::vector<bool>> portOccupied(numWorkers_);
+    for (std::size_t worker = 0U; worker < numWorkers_; ++worker) {
+        portOccupied[worker].assign(numPorts_[worker], false);
+    }
+
+    for (std::size_t worker = 0U; worker < numWorkers_; ++worker) {
+        for (std::size_t channel = vertexPointer_[worker]; channel < vertexPointer_[worker + 1U]; ++channel) {
+            const std::size_t tgt = edgeTargets_[channel] == numWorkers_ ? worker : edgeTargets_[channel];
+            if (targetPort_[channel] >= numPorts_[tgt]) { return false; }
+            if (portOccupied[tgt][targetPort_[channel]]) { return false; }
+            portOccupied[tgt][targetPort_[channel]] = true;
+        }
+    }
+
+    for (std::size_t worker = 0U; worker < numWorkers_; ++worker) {
+        if (vertexPointer_[worker] == vertexPointer_[worker + 1U]) { return false; }
+    }
+
+    if (channelBufferSize_ < maxBatchSize()) { return false; }
+    if (maxPushAttempts_ == 0U) { return false; }
+    if (enqueueFrequency_ == 0U) { return false; }
+
+    return true;
+}
+
+inline std::size_t DynamicQNetwork::maxBatchSize() const {
+    std::size_t max = 0U;
+    for (std::size_t i = 0U; i < batchSize_.size(); ++i) { max = std::max(max, batchSize_[i]); }
+    return max;
+}
+
+inline std::size_t DynamicQNetwork::maxPortNum() const {
+    std::size_t max = 0U;
+    for (std::size_t i = 0U; i < numPorts_.size(); ++i) { max = std::max(max, numPorts_[i]); }
+    return max;
+}
+
+inline bool DynamicQNetwork::hasSeparateLogicalCores() const {
+    std::vector<std::size_t> logicalCoresCopy = logicalCore_;
+    std::sort(logicalCoresCopy.begin(), logicalCoresCopy.end());
+
+    return std::adjacent_find(logicalCoresCopy.cbegin(), logicalCoresCopy.cend()) == logicalCoresCopy.cend();
+}
+
+inline void DynamicQNetwork::printQNetwork() const {
+    const std::string singleIndent = " ";
+    const std::string doubleIndent = singleIndent + singleIndent;
+
+    std::cout << "\nDynamicQNetwork:\n";
+    std::cout << singleIndent << "#Workers : " << numWorkers_ << "\n";
+    std::cout << singleIndent << "#Channels: " << numChannels_ << "\n";
+    std::cout << singleIndent << "EnQFreq  : " << enqueueFrequency_ << "\n";
+    std::cout << singleIndent << "ChanlSize: " << channelBufferSize_ << "\n";
+    std::cout << singleIndent << "MaxAttmps: " << maxPushAttempts_ << "\n";
+    std::cout << singleIndent << "Pinning  : ";
+    switch (corePinning_) {
+        case CorePinning::Strict: std::cout << "strict\n"; break;
+        case CorePinning::Remap: std::cout << "remap\n"; break;
+        case CorePinning::Unpinned: std::cout << "unpinned\n"; break;
+    }
+
+    std::cout << "\n" << singleIndent << "Linking:\n";
+    for (std::size_t i = 0U; i < numWorkers_; ++i) {
+        std::cout << doubleIndent << "Worker: " << i << "\n";
+        std::cout << doubleIndent << "Core  : " << logicalCore_[i] << "\n";
+
+        std::cout << doubleIndent << "Target: ";
+        for (std::size_t j = vertexPointer_[i]; j < vertexPointer_[i + 1U]; ++j) {
+            const std::size_t tgt = edgeTargets_[j] == numWorkers_ ? i : edgeTargets_[j];
+            std::cout << tgt;
+            if (j < vertexPointer_[i + 1U] - 1U) { std::cout << ", "; }
+        }
+        std::cout << "\n";
+
+        std::cout << doubleIndent << "Multip: ";
+        for (std::size_t j = vertexPointer_[i]; j < vertexPointer_[i + 1U]; ++j) {
+            std::cout << multiplicities_[j];
+            if (j < vertexPointer_[i + 1U] - 1U) { std::cout << ", "; }
+        }
+        std::cout << "\n";
+
+        std::cout << doubleIndent << "Batchs: ";
+        for (std::size_t j = vertexPointer_[i]; j < vertexPointer_[i + 1U]; ++j) {
+            std::cout << batchSize_[j];
+            if (j < vertexPointer_[i + 1U] - 1U) { std::cout << ", "; }
+        }
+        std::cout << "\n";
+        std::cout << "\n";
+    }
+}
+
+inline DynamicQNetwork::DynamicQNetwork(std::vector<std::size_t> vertexPointer,
+                                        std::vector<std::size_t> edgeTargets,
+                                        std::vector<std::size_t> logicalCore,
+                                        std::vector<std::size_t> multiplicities,
+                                        std::vector<std::size_t> batchSize,
+                                        std::size_t enqueueFrequency,
+                                        std::size_t channelBufferSize,
+                                        std::size_t maxPushAttempts) :
+    numWorkers_(vertexPointer.empty() ? 0U : vertexPointer.size() - 1U),
+    numChannels_(edgeTargets.size()),
+    enqueueFrequency_(enqueueFrequency),
+    channelBufferSize_(channelBufferSize),
+    maxPushAttempts_(maxPushAttempts),
+    vertexPointer_(std::move(vertexPointer)),
+    logicalCore_(std::move(logicalCore)),
+    edgeTargets_(std::move(edgeTargets)),
+    multiplicities_(std::move(multiplicities)),
+    batchSize_(std::move(batchSize)) {
+    assignTargetPorts();
+    changeToSelfPushLabels();
+};
+
+inline DynamicQNetwork::DynamicQNetwork(std::vector<std::size_t> vertexPointer,
+                                        std::vector<std::size_t> edgeTargets,
+                                        std::vector<std::size_t> logicalCore,
+                                        std::vector<std::size_t> multiplicities,
+                                        std::vector<std::size_t> batchSize) :
+    numWorkers_(vertexPointer.empty() ? 0U : vertexPointer.size() - 1U),
+    numChannels_(edgeTargets.size()),
+    vertexPointer_(std::move(vertexPointer)),
+    logicalCore_(std::move(logicalCore)),
+    edgeTargets_(std::move(edgeTargets)),
+    multiplicities_(std::move(multiplicities)),
+    batchSize_(std::move(batchSize)) {
+    setDefaultEnqueueFrequency();
+    setDefaultChannelBufferSize();
+    setDefaultMaxPushAttempts();
+    assignTargetPorts();
+    changeToSelfPushLabels();
+};
+
+inline DynamicQNetwork::DynamicQNetwork(std::vector<std::size_t> vertexPointer,
+                                        std::vector<std::size_t> edgeTargets,
+                                        std::vector<std::size_t> logicalCore,
+                                        std::vector<std::size_t> multiplicities) :
+    numWorkers_(vertexPointer.empty() ? 0U : vertexPointer.size() - 1U),
+    numChannels_(edgeTargets.size()),
+    vertexPointer_(std::move(vertexPointer)),
+    logicalCore_(std::move(logicalCore)),
+    edgeTargets_(std::move(edgeTargets)),
+    multiplicities_(std::move(multiplicities)) {
+    setDefaultBatchSize();
+    setDefaultEnqueueFrequency();
+    setDefaultChannelBufferSize();
+    setDefaultMaxPushAttempts();
+    assignTargetPorts();
+    changeToSelfPushLabels();
+};
+
+inline DynamicQNetwork::DynamicQNetwork(std::vector<std::size_t> vertexPointer,
+                                        std::vector<std::size_t> edgeTargets,
+                                        std::vector<std::size_t> logicalCore) :
+    numWorkers_(vertexPointer.empty() ? 0U : vertexPointer.size() - 1U),
+    numChannels_(edgeTargets.size()),
+    vertexPointer_(std::move(vertexPointer)),
+    logicalCore_(std::move(logicalCore)),
+    edgeTargets_(std::move(edgeTargets)) {
+    setDefaultMultiplicities();
+    setDefaultBatchSize();
+    setDefaultEnqueueFrequency();
+    setDefaultChannelBufferSize();
+    setDefaultMaxPushAttempts();
+    assignTargetPorts();
+    changeToSelfPushLabels();
+};
+
+inline DynamicQNetwork::DynamicQNetwork(std::vector<std::size_t> vertexPointer,
+                                        std::vector<std::size_t> edgeTargets) :
+    numWorkers_(vertexPointer.empty() ? 0U : vertexPointer.size() - 1U),
+    numChannels_(edgeTargets.size()),
+    vertexPointer_(std::move(vertexPointer)),
+    edgeTargets_(std::move(edgeTargets)) {
+    setDefaultLogicalCores();
+    setDefaultMultiplicities();
+    setDefaultBatchSize();
+    setDefaultEnqueueFrequency();
+    setDefaultChannelBufferSize();
+    setDefaultMaxPushAttempts();
+    assignTargetPorts();
+    changeToSelfPushLabels();
+};
+
+/**
+ * @brief Copies the linking and the options shared with a compile-time QNetwork. Options without run-time
+ * counterpart, e.g., the channel kind, are dropped.
+ *
+ */
+template <std::size_t workers, std::size_t channels>
+DynamicQNetwork::DynamicQNetwork(const QNetwork<workers, channels> &netw) :
+    numWorkers_(workers),
+    numChannels_(channels),
+    enqueueFrequency_(netw.enqueueFrequency_),
+    channelBufferSize_(netw.channelBufferSize_),
+    maxPushAttempts_(netw.maxPushAttempts_),
+    vertexPointer_(netw.vertexPointer_.cbegin(), netw.vertexPointer_.cend()),
+    numPorts_(netw.numPorts_.cbegin(), netw.numPorts_.cend()),
+    logicalCore_(netw.logicalCore_.cbegin(), netw.logicalCore_.cend()),
+    edgeTargets_(netw.edgeTargets_.cbegin(), netw.edgeTargets_.cend()),
+    multiplicities_(netw.multiplicities_.cbegin(), netw.multiplicities_.cend()),
+    targetPort_(netw.targetPort_.cbegin(), netw.targetPort_.cend()),
+    batchSize_(netw.batchSize_.cbegin(), netw.batchSize_.cend()),
+    corePinning_(netw.corePinning_) { };
+
+}        // end namespace spapq
@@ -0,0 +1,434 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <atomic>
+#include <barrier>
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Configuration/config.hpp"
+#include "Discrepancy/QNetworkTables.hpp"
+#include "DynamicQNetwork.hpp"
+#include "DynamicSpapQueueWorker.hpp"
+#include "Topology/CoreMapping.hpp"
+
+namespace spapq {
+
+/**
+ * @brief DynamicSpapQueue is the SpapQueue for a DynamicQNetwork, which is handed over at construction, such
+ * that the number of workers and the linking can be chosen at run time, e.g., from the number of cores of the
+ * machine. The discrepancy tables of the workers are computed when the queue is constructed. The queue is run
+ * with the same steps as the SpapQueue, i.e.,\n
+ * (1) initQueue, which allocates the workers,\n
+ * (2) pushBeforeProcessing, to populate the queue with initial tasks,\n
+ * (3) processQueue, to let the workers start processing the queue,\n
+ * (4) pushDuringProcessing, whilst the queue is running (and only then) additional tasks may be enqueued on
+ *     self-push channels,\n
+ * (5) waitProcessFinish, to wait till all of the tasks in the queue have been completed.
+ *
+ * Sizes, which the SpapQueue knows at compile time, are looked up at run time here and tasks are processed
+ * through the virtual table. The SpapQueue therefore remains the faster choice whenever the network is known
+ * at compile time. Its channels are always SPSCRing channels, workers spin when idle and termination is
+ * detected by the global count.
+ *
+ * @tparam T Type of queue element or task.
+ * @tparam WorkerTemplate The worker type to be used for the queue. Needs to inherit from DynamicWorkerResource.
+ * @tparam LocalQType Type of the local queue of each individual worker.
+ * @tparam padding Alignment of the global count, the worker resource pointers and the channels. Unlike the
+ * falseSharingPadding_ of a QNetwork, it has to be known at compile time and is hence not part of the
+ * DynamicQNetwork.
+ *
+ * @see SpapQueue
+ * @see DynamicQNetwork
+ * @see DynamicWorkerResource
+ */
+template <typename T,
+          template <class, BasicQueue> class WorkerTemplate,
+          BasicQueue LocalQType,
+          std::size_t padding = CACHE_LINE_SIZE>
+class DynamicSpapQueue final {
+    template <typename, BasicQueue>
+    friend class WorkerTemplate;
+    template <typename, BasicQueue>
+    friend class DynamicWorkerResource;
+
+  public:
+    using value_type = T;
+    static constexpr std::size_t padding_ = padding;
+
+    template <typename... Args>
+    bool initQueue(Args &&...workerArgs);
+    void processQueue();
+    void waitProcessFinish();
+    void requestStop();
+
+    inline const DynamicQNetwork &network() const noexcept;
+    inline const std::vector<std::size_t> &workerCores() const noexcept;
+
+    inline void pushBeforeProcessing(const value_type &val, const std::size_t workerId = 0U) noexcept;
+    inline void pushBeforeProcessing(value_type &&val, const std::size_t workerId = 0U) noexcept;
+    [[nodiscard("Push may fail when channel is full or queue has already finished.\n")]] inline bool
+    pushDuringProcessing(const value_type &val, const std::size_t channel) noexcept;
+    [[nodiscard("Push may fail when channel is full or queue has already finished.\n")]] inline bool
+    pushDuringProcessing(value_type &&val, const std::size_t channel) noexcept;
+
+    explicit DynamicSpapQueue(DynamicQNetwork netw);
+    DynamicSpapQueue(const DynamicSpapQueue &other) = delete;
+    DynamicSpapQueue(DynamicSpapQueue &&other) = delete;
+    DynamicSpapQueue &operator=(const DynamicSpapQueue &other) = delete;
+    DynamicSpapQueue &operator=(DynamicSpapQueue &&other) = delete;
+    ~DynamicSpapQueue() noexcept;
+
+  private:
+    using ThisQType = DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>;
+    using WorkerType = WorkerTemplate<ThisQType, LocalQType>;
+
+    const DynamicQNetwork netw_;        ///< Network dictating the linking of the workers.
+    const bool validNetwork_;           ///< Whether netw_ passed the checks the SpapQueue makes at compile time.
+    std::vector<std::vector<std::size_t>> channelTables_;        ///< Channel push table of each worker.
+
+    alignas(padding) std::atomic<std::size_t> globalCount_{0U};        ///< Is zero if and only if there is no
+                                                                        ///< task in the queue.
+    alignas(padding) std::vector<DynamicWorkerResource<ThisQType, LocalQType> *>
+        workerResources_;        ///< Resources of the workers.
+
+    std::atomic<bool> queueActive_{false};        ///< Keeps track whether the queue is active, i.e., whether
+                                                  ///< worker threads have been spawned.
+    std::atomic_flag startSignal_;        ///< The signal for the workers to start working on the tasks in the
+                                          ///< queue.
+    std::barrier<> allocateSignal_;        ///< Signals that it is now safe to enqueue tasks.
+    std::barrier<> safeToDeallocateSignal_;        ///< Signal that all workers have finished working and that
+                                                   ///< it is now safe to deallocate the worker resources.
+
+    std::vector<std::size_t> workerCores_;        ///< CPU each worker is pinned to or UNPINNED_CORE.
+    bool coreMappingReported_{false};             ///< Whether a remapping of the logical cores has been
+                                                  ///< reported.
+
+    std::vector<std::jthread> workers_;        ///< Worker threads.
+
+    template <typename... Args>
+    void threadWork(std::stop_token stoken, const std::size_t workerId, Args &&...workerArgs);
+
+    template <class InputIt>
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool pushInternal(
+        InputIt first, InputIt last, const std::size_t workerId, const std::size_t port) noexcept;
+
+    void mapWorkerCores();
+    static bool checkNetwork(const DynamicQNetwork &netw);
+
+    // Static asserts
+    static_assert(std::is_same_v<value_type, typename LocalQType::value_type>,
+                  "The local queue type needs to have matching value_type!\n");
+    static_assert(std::is_base_of_v<DynamicWorkerResource<ThisQType, LocalQType>, WorkerType>,
+                  "WorkerTemplate must be derived from DynamicWorkerResource.\n");
+    static_assert(std::is_nothrow_default_constructible_v<value_type>);
+    static_assert(std::is_nothrow_move_constructible_v<value_type>);
+    static_assert(std::is_nothrow_move_assignable_v<value_type>);
+};
+
+// Implementation Details
+
+/**
+ * @brief Takes over the network and computes the channel push tables of the workers.
+ *
+ * @param netw Network. If it is not valid, the queue refuses to be initialised.
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::DynamicSpapQueue(DynamicQNetwork netw) :
+    netw_(std::move(netw)),
+    validNetwork_(checkNetwork(netw_)),
+    workerResources_(netw_.numWorkers_, nullptr),
+    allocateSignal_(static_cast<std::ptrdiff_t>(netw_.numWorkers_ + 1U)),
+    safeToDeallocateSignal_(static_cast<std::ptrdiff_t>(netw_.numWorkers_)),
+    workerCores_(netw_.numWorkers_, UNPINNED_CORE),
+    workers_(netw_.numWorkers_) {
+    if (not validNetwork_) { return; }
+
+    channelTables_.reserve(netw_.numWorkers_);
+    for (std::size_t worker = 0U; worker < netw_.numWorkers_; ++worker) {
+        channelTables_.emplace_back(tables::qNetworkTable(netw_, worker));
+    }
+}
+
+/**
+ * @brief Run-time counterpart of the static asserts of the SpapQueue on its QNetwork.
+ *
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+bool DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::checkNetwork(const DynamicQNetwork &netw) {
+    if (not netw.isValidQNetwork()) {
+        std::cerr << "The DynamicQNetwork needs to be valid!\n";
+        return false;
+    }
+    if (netw.corePinning_ != CorePinning::Unpinned && (not netw.hasSeparateLogicalCores())) {
+        std::cerr << "Workers should be on separate logical Cores.\n";
+        return false;
+    }
+    if (not netw.isStronglyConnected()) {
+        std::cerr << "The DynamicQNetwork needs to be strongly connected to keep all workers busy.\n";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the network of the queue.
+ *
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+inline const DynamicQNetwork &DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::network() const noexcept {
+    return netw_;
+}
+
+/**
+ * @brief CPU each worker has been pinned to, or UNPINNED_CORE, as decided by the pinning mode of the network.
+ * Only valid after initQueue.
+ *
+ * @see CorePinning
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+inline const std::vector<std::size_t> &DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::workerCores()
+    const noexcept {
+    return workerCores_;
+}
+
+/**
+ * @brief Maps the logical cores of the network onto the CPUs the process may run on. A mapping which differs
+ * from the logical cores is reported the first time.
+ *
+ * @see mapLogicalCores
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+void DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::mapWorkerCores() {
+    workerCores_ = mapLogicalCores(netw_.logicalCore_, allowedCpus(), netw_.corePinning_);
+
+    if (netw_.corePinning_ == CorePinning::Remap && workerCores_ != netw_.logicalCore_
+        && (not coreMappingReported_)) {
+        std::cerr << "DynamicSpapQueue remapped the logical cores of its network onto the allowed CPUs.\n";
+        printCoreMapping(netw_.logicalCore_, workerCores_);
+        coreMappingReported_ = true;
+    }
+}
+
+/**
+ * @brief Wait till the whole queue has finished processing all tasks.
+ *
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+void DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::waitProcessFinish() {
+    for (auto &thread : workers_) {
+        if (thread.joinable()) { thread.join(); }
+    }
+    globalCount_.store(0U, std::memory_order_relaxed);        // In case a stop was requested
+    startSignal_.clear(std::memory_order_relaxed);
+    queueActive_.store(false, std::memory_order_release);
+}
+
+/**
+ * @brief Initialises the queue by allocating resources and the worker thread.
+ *
+ * @param workerArgs Arguments to be passed to the workers. Each worker receives its own copy, hence
+ * arguments to be shared need to be wrapped by std::ref.
+ * @return true If initialisation has succeeded, i.e., not already initialised.
+ * @return false If the queue is already active or its network is not valid.
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+template <typename... Args>
+bool DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::initQueue(Args &&...workerArgs) {
+    if (not validNetwork_) {
+        std::cerr << "DynamicSpapQueue cannot be initiated with an invalid DynamicQNetwork!\n";
+        return false;
+    }
+    if (queueActive_.exchange(true, std::memory_order_acq_rel)) {
+        std::cerr << "DynamicSpapQueue is already active and cannot be initiated again!\n";
+        return false;
+    }
+
+    mapWorkerCores();
+    for (std::size_t worker = 0U; worker < netw_.numWorkers_; ++worker) {
+        workers_[worker] = std::jthread(
+            std::bind_front(&ThisQType::threadWork<std::decay_t<Args>...>, this), worker, workerArgs...);
+    }
+
+    allocateSignal_.arrive_and_wait();
+    return true;
+}
+
+/**
+ * @brief Signals the workers to begin processing the queue.
+ *
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+void DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::processQueue() {
+    startSignal_.test_and_set(std::memory_order_release);
+    startSignal_.notify_all();
+}
+
+/**
+ * @brief Batch push onto channel, return whether succeeded.
+ *
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+template <class InputIt>
+inline bool DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::pushInternal(InputIt first,
+                                                                          InputIt last,
+                                                                          const std::size_t workerId,
+                                                                          const std::size_t port) noexcept {
+    return workerResources_[workerId]->push(first, last, port);
+}
+
+/**
+ * @brief Intructions to be executed by the worker.
+ *
+ * @param stoken Stop token
+ * @param workerId Worker id.
+ * @param workerArgs Arguments to be passed to the worker constructor.
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+template <typename... Args>
+void DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::threadWork(std::stop_token stoken,
+                                                                 const std::size_t workerId,
+                                                                 Args &&...workerArgs) {
+    // pinning thread, the initialising thread reads workerCores_ only after the allocate signal
+    pinWorkerThread(workerId, workerCores_[workerId], netw_.corePinning_);
+
+    // init resource
+    WorkerType resource(*this, channelTables_[workerId], workerId, std::forward<Args>(workerArgs)...);
+    workerResources_[workerId] = &resource;
+
+    // signal reference set
+    allocateSignal_.arrive_and_wait();
+
+    // awaiting unsafe enqueuing and global starting signal
+    startSignal_.wait(false, std::memory_order_acquire);
+
+    // run
+    resource.run(stoken);
+
+    // signal and await process finished
+    safeToDeallocateSignal_.arrive_and_wait();
+
+    // unset reference
+    workerResources_[workerId] = nullptr;
+}
+
+/**
+ * @brief Request early stop or termination of the queue.
+ *
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+void DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::requestStop() {
+    if (not queueActive_.load(std::memory_order_acquire)) { return; }
+
+    for (auto &workerThread : workers_) { workerThread.request_stop(); }
+    processQueue();        // In case worker threads are waiting for start signal
+}
+
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::~DynamicSpapQueue() noexcept {
+    queueActive_.store(true, std::memory_order_relaxed);        // Such that nobody else can start the queue
+    requestStop();        // Required because worker threads can be stuck awaiting start signal
+    // Deconstructor of jthread automatically joins the worker threads and thus destroys the worker resources
+}
+
+/**
+ * @brief Enqueues a copy of an initial task into the local queue of a worker. Only to be used after
+ * initialisation and before processing the queue.
+ *
+ * @param val Task or queue element.
+ * @param workerId Worker id whose local queue to push to.
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+inline void DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::pushBeforeProcessing(
+    const value_type &val, const std::size_t workerId) noexcept {
+    pushBeforeProcessing(value_type(val), workerId);
+}
+
+/**
+ * @brief Moves initial tasks into the local queue of a worker. Only to be used after initialisation and
+ * before processing the queue.
+ *
+ * @param val Task or queue element.
+ * @param workerId Worker id whose local queue to push to.
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+inline void DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::pushBeforeProcessing(
+    value_type &&val, const std::size_t workerId) noexcept {
+    assert(workerId < netw_.numWorkers_);
+    workerResources_[workerId]->pushUnsafe(std::move(val));
+    globalCount_.fetch_add(1U, std::memory_order_release);
+}
+
+/**
+ * @brief Enqueues a copy of a task into a self-push channel of the queue. Only to be used after
+ * initialisation and during processing the queue.
+ *
+ * @param val Task or queue element.
+ * @param channel A self-push channel into which to push.
+ * @return true If push succeeded.
+ * @return false If push failed. This is either because the channel buffer is full or the queue has already
+ * finished.
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+inline bool DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::pushDuringProcessing(
+    const value_type &val, const std::size_t channel) noexcept {
+    return pushDuringProcessing(value_type(val), channel);
+}
+
+/**
+ * @brief Moves tasks into a self-push channel of the queue. Only to be used after initialisation and during
+ * processing the queue. The task is left untouched if the push fails.
+ *
+ * @param val Task or queue element.
+ * @param channel A self-push channel into which to push.
+ * @return true If push succeeded.
+ * @return false If push failed. This is either because the channel buffer is full or the queue has already
+ * finished.
+ */
+template <typename T, template <class, BasicQueue> class WorkerTemplate, BasicQueue LocalQType, std::size_t padding>
+inline bool DynamicSpapQueue<T, WorkerTemplate, LocalQType, padding>::pushDuringProcessing(
+    value_type &&val, const std::size_t channel) noexcept {
+    assert(channel < netw_.numChannels_ && "Must be a valid channel in the DynamicQNetwork.");
+    assert(netw_.edgeTargets_[channel] == netw_.numWorkers_ && "Channel must not have a producer.");
+
+    bool success = false;
+
+    // Checks if queue is still running and if so signals that there is more work to come
+    std::size_t prevCount = globalCount_.load(std::memory_order_relaxed);
+    while (prevCount > 0U
+           && (not globalCount_.compare_exchange_weak(
+               prevCount, prevCount + 1U, std::memory_order_relaxed, std::memory_order_relaxed))) { };
+
+    // Only inserts if queue is still running
+    if (prevCount > 0U) {
+        success = workerResources_[netw_.source(channel)]->push(std::move(val), netw_.targetPort_[channel]);
+        if (not success) { globalCount_.fetch_sub(1U, std::memory_order_relaxed); }
+    }
+
+    return success;
+}
+
+}        // end namespace spapq
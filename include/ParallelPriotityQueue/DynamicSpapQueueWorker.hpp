@@ -0,0 +1,437 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <stop_token>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ParallelPriotityQueue/Concepts/BasicQueue.hpp"
+#include "ParallelPriotityQueue/DynamicQNetwork.hpp"
+#include "ParallelPriotityQueue/PushIterator.hpp"
+#include "RingBuffer/DynamicRingBuffer.hpp"
+
+namespace spapq {
+
+/**
+ * @brief A base class for the functionality of the local worker of the DynamicSpapQueue. It follows
+ * WorkerResource, but reads the linking from the DynamicQNetwork of the global queue at run time and keeps its
+ * channels and buffers on the heap.
+ *
+ * @tparam GlobalQType Type of the global queue which employs/deploys this worker.
+ * @tparam LocalQType Type of the local (worker personal) queue.
+ *
+ * @see DynamicSpapQueue
+ * @see WorkerResource
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+class DynamicWorkerResource {
+    template <typename, template <class, BasicQueue> class, BasicQueue, std::size_t>
+    friend class DynamicSpapQueue;
+
+  public:
+    using value_type = GlobalQType::value_type;
+
+  private:
+    using ChannelType = DynamicRingBuffer<value_type, GlobalQType::padding_>;
+
+    GlobalQType &globalQueue_;                        ///< Reference to the global queue.
+    const DynamicQNetwork &netw_;                     ///< Network of the global queue.
+    const std::vector<std::size_t> channelIndices_;        ///< Order of outgoing channels to push to.
+    std::vector<value_type> outBuffer_;        ///< Small buffer before pushing to outgoing channel.
+
+    const std::size_t workerId_;           ///< Worker Id in the global queue.
+    std::size_t localCount_{0U};           ///< A partial account of the number of tasks in the global queue.
+    std::size_t bufferSize_{0U};           ///< Number of tasks in the outBuffer_.
+    std::size_t channelPointer_{0U};        ///< Index of the next outgoing channel in channelIndices_.
+
+    LocalQType queue_;                                         ///< Worker local queue.
+    std::vector<std::unique_ptr<ChannelType>> inPorts_;        ///< Incomming channels.
+
+    inline void incrGlobalCount(const std::size_t n = 1U) noexcept;
+    inline void decrGlobalCount() noexcept;
+    inline bool tasksRemaining() const noexcept;
+
+    inline std::size_t currentChannel() const noexcept;
+    inline void advanceChannelPointer() noexcept;
+    [[nodiscard("Push may fail when channel is full.\n")]] inline bool pushOutBuffer() noexcept;
+    template <class InputIt>
+    [[nodiscard("Push may fail when channel is full.\n")]] inline bool pushOutChannel(InputIt first,
+                                                                                      InputIt last) noexcept;
+    inline void routeTask(value_type &&val) noexcept;
+    inline void pushOutBufferSelf(const std::size_t from) noexcept;
+
+    inline void enqueueInChannels() noexcept;
+    inline value_type takeTop() noexcept;
+    virtual void processElement(value_type &&val) noexcept = 0;
+
+    [[nodiscard("Push may fail when channel is full.\n")]] inline bool push(value_type &&val,
+                                                                            const std::size_t port) noexcept;
+    template <class InputIt>
+    [[nodiscard("Push may fail when channel is full.\n")]] inline bool push(InputIt first,
+                                                                            InputIt last,
+                                                                            const std::size_t port) noexcept;
+
+    inline void pushUnsafe(value_type &&val) noexcept;
+
+    inline void run(std::stop_token stoken) noexcept;
+
+  protected:
+    inline std::size_t workerId() const noexcept;
+    inline void enqueueGlobal(const value_type &val) noexcept;
+    inline void enqueueGlobal(value_type &&val) noexcept;
+    template <class InputIt>
+    inline void enqueueGlobal(InputIt first, InputIt last) noexcept;
+
+    template <typename... Args>
+    DynamicWorkerResource(GlobalQType &globalQueue,
+                          const std::vector<std::size_t> &channelIndices,
+                          std::size_t workerId,
+                          Args &&...localQargs);
+
+  public:
+    DynamicWorkerResource(const DynamicWorkerResource &other) = delete;
+    DynamicWorkerResource(DynamicWorkerResource &&other) = delete;
+    DynamicWorkerResource &operator=(const DynamicWorkerResource &other) = delete;
+    DynamicWorkerResource &operator=(DynamicWorkerResource &&other) = delete;
+    virtual ~DynamicWorkerResource() = default;
+};
+
+// Implementation details
+
+/**
+ * @brief Builds the worker. Being constructed on the thread of the worker, the channel table, the outbuffer
+ * and the incomming channels are allocated close to the core the worker is pinned to.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+template <typename... Args>
+DynamicWorkerResource<GlobalQType, LocalQType>::DynamicWorkerResource(
+    GlobalQType &globalQueue,
+    const std::vector<std::size_t> &channelIndices,
+    std::size_t workerId,
+    Args &&...localQargs) :
+    globalQueue_(globalQueue),
+    netw_(globalQueue.netw_),
+    channelIndices_(channelIndices),
+    outBuffer_(netw_.maxBatchSize()),
+    workerId_(workerId),
+    queue_(std::forward<Args>(localQargs)...) {
+    inPorts_.reserve(netw_.inDegree(workerId_));
+    for (std::size_t port = 0U; port < netw_.inDegree(workerId_); ++port) {
+        inPorts_.emplace_back(std::make_unique<ChannelType>(netw_.channelBufferSize_));
+    }
+}
+
+template <typename GlobalQType, BasicQueue LocalQType>
+inline bool DynamicWorkerResource<GlobalQType, LocalQType>::push(value_type &&val,
+                                                                 const std::size_t port) noexcept {
+    return inPorts_[port]->push(std::move(val));
+}
+
+template <typename GlobalQType, BasicQueue LocalQType>
+template <class InputIt>
+inline bool DynamicWorkerResource<GlobalQType, LocalQType>::push(InputIt first,
+                                                                 InputIt last,
+                                                                 const std::size_t port) noexcept {
+    return inPorts_[port]->push(first, last);
+}
+
+/**
+ * @brief Adds a copy of a task to the global queue.
+ *
+ * @param val Task.
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::enqueueGlobal(const value_type &val) noexcept {
+    enqueueGlobal(value_type(val));
+}
+
+/**
+ * @brief Adds a new task to the global queue.
+ *
+ * @param val Task.
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::enqueueGlobal(value_type &&val) noexcept {
+    incrGlobalCount();
+    routeTask(std::move(val));
+}
+
+/**
+ * @brief Adds the tasks in [first, last) to the global queue with a single update of the count. Whenever the
+ * outbuffer is empty and enough tasks remain, a whole batch is pushed from the range straight into the
+ * current outgoing channel. Pass std::move_iterator to move the tasks.
+ *
+ * @param first Beginning of the range of tasks.
+ * @param last End of the range of tasks.
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+template <class InputIt>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::enqueueGlobal(InputIt first, InputIt last) noexcept {
+    std::size_t numRemaining = static_cast<std::size_t>(std::distance(first, last));
+    incrGlobalCount(numRemaining);
+
+    while (numRemaining > 0U) {
+        if (bufferSize_ == 0U) {
+            const std::size_t batch = netw_.batchSize_[currentChannel()];
+            if (numRemaining >= batch) {
+                const InputIt sliceEnd = std::next(first, static_cast<std::ptrdiff_t>(batch));
+                if (pushOutChannel(first, sliceEnd)) {
+                    first = sliceEnd;
+                    numRemaining -= batch;
+                    advanceChannelPointer();
+                    continue;
+                }
+            }
+        }
+
+        value_type val(*first);
+        ++first;
+        --numRemaining;
+        routeTask(std::move(val));
+    }
+}
+
+/**
+ * @brief Sends a task, which has already been counted, towards the current outgoing channel.
+ *
+ * @param val Task.
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::routeTask(value_type &&val) noexcept {
+    assert(bufferSize_ < outBuffer_.size());
+
+    outBuffer_[bufferSize_] = std::move(val);
+    ++bufferSize_;
+
+    std::size_t maxAttempts = netw_.maxPushAttempts_;
+    while (bufferSize_ >= netw_.batchSize_[currentChannel()] && maxAttempts > 0U) {
+        if (not pushOutBuffer()) { --maxAttempts; }
+
+        advanceChannelPointer();
+    }
+    if (maxAttempts == 0U) [[unlikely]] { pushOutBufferSelf(0U); }
+}
+
+/**
+ * @brief Returns the current outgoing channel.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline std::size_t DynamicWorkerResource<GlobalQType, LocalQType>::currentChannel() const noexcept {
+    return channelIndices_[channelPointer_];
+}
+
+/**
+ * @brief Moves on to the next outgoing channel in the channel indices table.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::advanceChannelPointer() noexcept {
+    ++channelPointer_;
+    if (channelPointer_ == channelIndices_.size()) { channelPointer_ = 0U; }
+}
+
+/**
+ * @brief Pushes the last batch of the outbuffer to the current outgoing channel.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline bool DynamicWorkerResource<GlobalQType, LocalQType>::pushOutBuffer() noexcept {
+    const std::size_t channel = currentChannel();
+    const std::size_t batch = netw_.batchSize_[channel];
+    assert(batch <= bufferSize_);
+    const std::size_t from = bufferSize_ - batch;
+
+    const std::size_t targetWorker = netw_.edgeTargets_[channel];
+    if (targetWorker == netw_.numWorkers_) {        // netw.numWorkers_ is reserved for self-push
+        pushOutBufferSelf(from);
+        return true;
+    }
+
+    const auto itBegin = std::next(outBuffer_.begin(), static_cast<std::ptrdiff_t>(from));
+    const auto itEnd = std::next(outBuffer_.begin(), static_cast<std::ptrdiff_t>(bufferSize_));
+    const bool successfulPush = globalQueue_.pushInternal(
+        std::make_move_iterator(itBegin), std::make_move_iterator(itEnd), targetWorker, netw_.targetPort_[channel]);
+    if (successfulPush) { bufferSize_ = from; }
+
+    return successfulPush;
+}
+
+/**
+ * @brief Pushes the tasks in [first, last) to the current outgoing channel, or into the local queue for a
+ * self-push channel.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+template <class InputIt>
+inline bool DynamicWorkerResource<GlobalQType, LocalQType>::pushOutChannel(InputIt first,
+                                                                           InputIt last) noexcept {
+    const std::size_t channel = currentChannel();
+    const std::size_t targetWorker = netw_.edgeTargets_[channel];
+    if (targetWorker == netw_.numWorkers_) {        // netw.numWorkers_ is reserved for self-push
+        for (; first != last; ++first) { queue_.push(value_type(*first)); }
+        return true;
+    }
+
+    return globalQueue_.pushInternal(first, last, targetWorker, netw_.targetPort_[channel]);
+}
+
+/**
+ * @brief Moves all task from (including) position from in the outbuffer to the local queue.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::pushOutBufferSelf(const std::size_t from) noexcept {
+    for (std::size_t i = from; i < bufferSize_; ++i) { queue_.push(std::move(outBuffer_[i])); }
+    bufferSize_ = from;
+}
+
+/**
+ * @brief Enqueues all tasks in the incomming channels into the local queue.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::enqueueInChannels() noexcept {
+    for (auto &port : inPorts_) { port->drain(PushIterator<LocalQType>(queue_)); }
+}
+
+/**
+ * @brief Starts running the local worker and processes the queue until the global queue is empty or stop has
+ * been requested via stop token. The periods of the checks are only known at run time, hence they are counted
+ * down rather than taken modulo.
+ *
+ * @param stoken Stop token.
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::run(std::stop_token stoken) noexcept {
+    constexpr std::size_t stopCheckPeriod = 128U;
+
+    std::size_t untilStopCheck = 0U;
+    std::size_t untilEnqueue = 0U;
+    while (tasksRemaining() && (not stoken.stop_requested())) {
+        while ((not queue_.empty())) [[likely]] {
+            if (untilStopCheck == 0U) {
+                if (stoken.stop_requested()) [[unlikely]] { break; }
+                untilStopCheck = stopCheckPeriod;
+            }
+            --untilStopCheck;
+
+            if (untilEnqueue == 0U) {
+                enqueueInChannels();
+                untilEnqueue = netw_.enqueueFrequency_;
+            }
+            --untilEnqueue;
+
+            value_type val = takeTop();
+            queue_.pop();
+            processElement(std::move(val));
+            decrGlobalCount();
+        }
+        enqueueInChannels();
+        pushOutBufferSelf(0U);
+    }
+}
+
+/**
+ * @brief Takes the top task out of the local queue ahead of popping it.
+ *
+ * @see WorkerResource::takeTop
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline GlobalQType::value_type DynamicWorkerResource<GlobalQType, LocalQType>::takeTop() noexcept {
+    if constexpr (std::is_lvalue_reference_v<decltype(queue_.top())>) {
+        return std::move(const_cast<value_type &>(queue_.top()));
+    } else {
+        return queue_.top();
+    }
+}
+
+/**
+ * @brief Moves a task directly into the local queue. This should never be called when the worker is
+ * running/processing the global queue.
+ *
+ * @param val Task.
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::pushUnsafe(value_type &&val) noexcept {
+    queue_.push(std::move(val));
+}
+
+/**
+ * @brief Returns the worker Id in the global queue.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline std::size_t DynamicWorkerResource<GlobalQType, LocalQType>::workerId() const noexcept {
+    return workerId_;
+}
+
+/**
+ * @brief Increases the global count by n.
+ *
+ * @see WorkerResource::incrGlobalCount
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::incrGlobalCount(const std::size_t n) noexcept {
+    localCount_ += n;
+    const std::size_t qSize = queue_.size();
+    if (localCount_ >= qSize) {
+        const std::size_t newLocalCount = qSize / 2;
+        const std::size_t diff = localCount_ - newLocalCount;
+
+        localCount_ = newLocalCount;
+        globalQueue_.globalCount_.fetch_add(diff, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Decreases the global count by one.
+ *
+ * @see WorkerResource::decrGlobalCount
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline void DynamicWorkerResource<GlobalQType, LocalQType>::decrGlobalCount() noexcept {
+    if (localCount_ == 0U) {
+        const std::size_t newLocalCount = queue_.size() / 2;
+        const std::size_t diff = newLocalCount + 1U;
+
+        localCount_ = newLocalCount;
+        globalQueue_.globalCount_.fetch_sub(diff, std::memory_order_relaxed);
+    } else {
+        --localCount_;
+    }
+}
+
+/**
+ * @brief Checks whether the queue still holds tasks.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+inline bool DynamicWorkerResource<GlobalQType, LocalQType>::tasksRemaining() const noexcept {
+    return globalQueue_.globalCount_.load(std::memory_order_acquire) > 0U;
+}
+
+}        // end namespace spapq
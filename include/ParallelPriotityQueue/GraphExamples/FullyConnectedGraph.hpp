@@ -18,6 +18,7 @@ limitations under the License.
 
 #pragma once
 
+#include "ParallelPriotityQueue/DynamicQNetwork.hpp"
 #include "ParallelPriotityQueue/QNetwork.hpp"
 
 namespace spapq {
@@ -43,4 +44,23 @@ consteval QNetwork<N, N * N> FULLY_CONNECTED_GRAPH() {
     return QNetwork<N, N * N>(vertexPtr, edges);
 };
 
+/**
+ * @brief A fully connected DynamicQNetwork including all self-loops, with the number of workers chosen at run
+ * time.
+ *
+ * @param N Number of workers.
+ *
+ * @see FULLY_CONNECTED_GRAPH
+ */
+inline DynamicQNetwork DYNAMIC_FULLY_CONNECTED_GRAPH(const std::size_t N) {
+    std::vector<std::size_t> vertexPtr(N + 1U);
+    std::vector<std::size_t> edges(N * N);
+
+    for (std::size_t i = 0U; i < N + 1U; ++i) { vertexPtr[i] = N * i; }
+
+    for (std::size_t i = 0U; i < N * N; ++i) { edges[i] = (i + (i / N)) % N; }
+
+    return DynamicQNetwork(std::move(vertexPtr), std::move(edges));
+};
+
 }        // end namespace spapq
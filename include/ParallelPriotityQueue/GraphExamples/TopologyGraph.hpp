@@ -0,0 +1,132 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ParallelPriotityQueue/DynamicQNetwork.hpp"
+#include "Topology/CpuTopology.hpp"
+
+namespace spapq {
+
+/**
+ * @brief Channel parameters of the hierarchical network generated from a CpuTopology. The multiplicities
+ * are per channel, i.e., the share of tasks a worker sends to another node is interNodeMultiplicity_ over the
+ * sum of the multiplicities of all its outgoing channels.
+ *
+ * @see TOPOLOGY_AWARE_GRAPH
+ */
+struct TopologyGraphParameters {
+    std::size_t intraNodeBatchSize_ = 8U;          ///< Batch size of the channels within a NUMA node.
+    std::size_t intraNodeMultiplicity_ = 2U;       ///< Multiplicity of the channels within a NUMA node.
+    std::size_t interNodeBatchSize_ = 64U;         ///< Batch size of the channels across NUMA nodes.
+    std::size_t interNodeMultiplicity_ = 1U;       ///< Multiplicity of the channels across NUMA nodes.
+    std::size_t smtSiblingBatchSize_ = 2U;         ///< Batch size of the channels between SMT siblings.
+    std::size_t smtSiblingMultiplicity_ = 4U;      ///< Multiplicity of the channels between SMT siblings.
+    bool physicalCoresOnly_ = false;               ///< Whether only one worker is placed on every physical
+                                                   ///< core, leaving its SMT siblings idle.
+};
+
+/**
+ * @brief A hierarchical DynamicQNetwork with one worker pinned to every logical CPU of the topology. Within
+ * a NUMA node the workers are fully connected, including self-loops, by small batch channels. Across nodes
+ * every worker only has a single large batch channel to each other node, targeting the worker of the same
+ * local rank (modulo the node size), such that high-priority tasks mix across nodes at a lower rate and in
+ * larger chunks. Workers on SMT siblings share their L1 and L2 caches, hence the channels between them are
+ * given the highest multiplicity and the smallest batches.
+ *
+ * @param topology Machine topology, e.g., CpuTopology::fromSysfs().
+ * @param params Batch sizes and multiplicities of the channels, and whether SMT siblings are left idle.
+ *
+ * @see CpuTopology
+ * @see DYNAMIC_FULLY_CONNECTED_GRAPH
+ */
+inline DynamicQNetwork TOPOLOGY_AWARE_GRAPH(
+    const CpuTopology &topology, const TopologyGraphParameters &params = TopologyGraphParameters()) {
+    const CpuTopology placement = params.physicalCoresOnly_ ? topology.physicalCoresOnly() : topology;
+    const std::vector<LogicalCpu> &cpus = placement.cpus();
+    const std::size_t numWorkers = cpus.size();
+
+    // Workers of a node are consecutive as the topology is sorted by node
+    std::vector<std::size_t> nodeBegin;
+    for (std::size_t worker = 0U; worker < numWorkers; ++worker) {
+        if (worker == 0U || cpus[worker].node_ != cpus[worker - 1U].node_) { nodeBegin.push_back(worker); }
+    }
+    const std::size_t numNodes = nodeBegin.size();
+    nodeBegin.push_back(numWorkers);
+
+    std::vector<std::size_t> vertexPtr(numWorkers + 1U, 0U);
+    std::vector<std::size_t> edges;
+    std::vector<std::size_t> logicalCores(numWorkers);
+    std::vector<std::size_t> multiplicities;
+    std::vector<std::size_t> batchSizes;
+
+    for (std::size_t node = 0U; node < numNodes; ++node) {
+        const std::size_t nodeSize = nodeBegin[node + 1U] - nodeBegin[node];
+
+        for (std::size_t rank = 0U; rank < nodeSize; ++rank) {
+            const std::size_t worker = nodeBegin[node] + rank;
+            logicalCores[worker] = cpus[worker].cpu_;
+
+            for (std::size_t i = 0U; i < nodeSize; ++i) {
+                const std::size_t target = nodeBegin[node] + ((rank + i) % nodeSize);
+                edges.push_back(target);
+
+                if (target != worker && cpus[target].package_ == cpus[worker].package_
+                    && cpus[target].core_ == cpus[worker].core_) {
+                    multiplicities.push_back(params.smtSiblingMultiplicity_);
+                    batchSizes.push_back(params.smtSiblingBatchSize_);
+                } else {
+                    multiplicities.push_back(params.intraNodeMultiplicity_);
+                    batchSizes.push_back(params.intraNodeBatchSize_);
+                }
+            }
+
+            for (std::size_t i = 1U; i < numNodes; ++i) {
+                const std::size_t otherNode = (node + i) % numNodes;
+                const std::size_t otherNodeSize = nodeBegin[otherNode + 1U] - nodeBegin[otherNode];
+
+                edges.push_back(nodeBegin[otherNode] + (rank % otherNodeSize));
+                multiplicities.push_back(params.interNodeMultiplicity_);
+                batchSizes.push_back(params.interNodeBatchSize_);
+            }
+
+            vertexPtr[worker + 1U] = edges.size();
+        }
+    }
+
+    return DynamicQNetwork(std::move(vertexPtr),
+                           std::move(edges),
+                           std::move(logicalCores),
+                           std::move(multiplicities),
+                           std::move(batchSizes));
+};
+
+/**
+ * @brief The topology-aware network of the machine the program is running on.
+ *
+ * @see TOPOLOGY_AWARE_GRAPH
+ */
+inline DynamicQNetwork TOPOLOGY_AWARE_GRAPH(
+    const TopologyGraphParameters &params = TopologyGraphParameters()) {
+    return TOPOLOGY_AWARE_GRAPH(CpuTopology::fromSysfs(), params);
+};
+
+}        // end namespace spapq
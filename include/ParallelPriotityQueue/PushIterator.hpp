@@ -0,0 +1,66 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include "ParallelPriotityQueue/Concepts/BasicQueue.hpp"
+
+namespace spapq {
+
+/**
+ * @brief An output iterator which pushes every element assigned to it into a queue, much like
+ * std::back_insert_iterator does for containers.
+ *
+ * @tparam QType Type of the queue.
+ */
+template <BasicQueue QType>
+class PushIterator {
+  private:
+    QType *queue_;
+
+  public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    explicit constexpr PushIterator(QType &queue) noexcept : queue_(&queue) { }
+
+    inline PushIterator &operator=(const typename QType::value_type &val) {
+        queue_->push(val);
+        return *this;
+    }
+
+    inline PushIterator &operator=(typename QType::value_type &&val) {
+        queue_->push(std::move(val));
+        return *this;
+    }
+
+    inline PushIterator &operator*() noexcept { return *this; }
+
+    inline PushIterator &operator++() noexcept { return *this; }
+
+    inline PushIterator operator++(int) noexcept { return *this; }
+};
+
+}        // end namespace spapq
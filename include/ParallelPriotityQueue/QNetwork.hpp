@@ -20,10 +20,61 @@ limitations under the License.
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <iostream>
 
+#include "Configuration/config.hpp"
+
 namespace spapq {
 
+/**
+ * @brief The kind of channel linking the workers.
+ *
+ */
+enum class ChannelKind : unsigned {
+    SPSCRing,             ///< Single-producer single-consumer RingBuffer, one port per incomming channel.
+    MPSCRing,             ///< Multi-producer single-consumer RingBuffer, allowing channels to share a port.
+    SPSCSegmented,        ///< Unbounded single-producer single-consumer channel of recycled segments of size
+                          ///< channelBufferSize_. Pushes to other workers never fall back to self-push.
+    SPSCRecord            ///< Single-producer single-consumer channel of serialised variable-length tasks.
+                          ///< channelBufferSize_ is its size in bytes. Requires a SerialisableTask.
+};
+
+/**
+ * @brief What a worker does when its local queue and incomming channels are empty.
+ *
+ */
+enum class IdlePolicy : unsigned {
+    Spin,           ///< Keeps polling the incomming channels and checking for termination without pause.
+    Backoff,        ///< Pauses the core between polls, doubling the number of pauses up to a limit.
+    Yield,          ///< Yields the core to the operating system between polls.
+    Park            ///< Backs off for a few polls and then sleeps until a producer pushes to one of its
+                    ///< ports, the queue runs out of tasks or a stop is requested.
+};
+
+/**
+ * @brief How the workers detect that the queue has run out of tasks.
+ *
+ */
+enum class TerminationDetection : unsigned {
+    GlobalCount,        ///< A single global count, updated whenever the partial count of a worker drifts too far
+                        ///< from the size of its local queue, and read by every worker without tasks.
+    Quiescence          ///< Every worker tallies the tasks it created and processed in its own cache line. A
+                        ///< worker without tasks sums up all tallies and the queue finishes once every created
+                        ///< task has been processed. Busy workers never write to a shared cache line.
+};
+
+/**
+ * @brief How the worker threads are pinned to the logical cores of the network.
+ *
+ */
+enum class CorePinning : unsigned {
+    Strict,        ///< Pins every worker to its logicalCore_ and terminates the program if that fails.
+    Remap,         ///< Maps the logical cores onto the CPUs the process may run on, e.g., the cpuset of its
+                   ///< container, preserving their order. Workers which cannot be pinned run unpinned.
+    Unpinned       ///< Leaves the placement of the worker threads to the operating system.
+};
+
 /**
  * @brief A Network describing how the queue should be interlinked.
  *
@@ -50,6 +101,40 @@ struct QNetwork {
     std::array<std::size_t, channels> targetPort_;        ///< Local index of channel of receiving worker.
     std::array<std::size_t, channels> batchSize_;         ///< Number of tasks to be pushed over a channel in
                                                           ///< one go.
+    ChannelKind channelKind_{ChannelKind::SPSCRing};        ///< Kind of channel used for the ports.
+    bool streamingPushes_{false};        ///< Whether batches are pushed to other workers with non-temporal
+                                         ///< stores, bypassing the cache of the producer. Only used by
+                                         ///< SPSCRing channels.
+    std::size_t broadcastBufferSize_{0U};        ///< Number of messages retained by the broadcast channel of
+                                                 ///< each worker. Zero disables broadcasts.
+    bool portDoorbells_{false};        ///< Whether producers flag the ports they pushed to, such that workers
+                                       ///< only poll the flagged ports.
+    std::array<std::size_t, channels> drainQuota_{};        ///< Maximal number of tasks taken from the
+                                                            ///< port of a channel per check of the
+                                                            ///< incomming channels. Quotas of channels
+                                                            ///< sharing a port add up. Zero is unlimited.
+    std::size_t drainBudget_{0U};        ///< Maximal number of tasks taken from all ports of a worker per
+                                         ///< check of the incomming channels. Zero is unlimited.
+    std::size_t processBatchSize_{1U};        ///< Maximal number of top tasks handed to processBatch at once.
+                                              ///< One processes each task with processElement.
+    bool continuations_{false};        ///< Whether a child which beats the local top, while the table
+                                       ///< keeps the task local, is run right after its parent without
+                                       ///< passing through the local queue. A continuation counts towards
+                                       ///< the batch of the self-push. Requires a ComparableQueue.
+    IdlePolicy idlePolicy_{IdlePolicy::Spin};        ///< Behaviour of workers without tasks.
+    TerminationDetection termination_{TerminationDetection::GlobalCount};        ///< How workers detect that
+                                                                                 ///< the queue is empty.
+    bool persistentWorkers_{false};        ///< Whether the pinned worker threads, together with their local
+                                           ///< queues and channels, are kept alive between runs of the queue.
+    bool staticDispatch_{false};        ///< Whether the worker threads call processElement and processBatch
+                                        ///< of the worker type directly instead of through the virtual
+                                        ///< table. Requires the worker type to declare the handlers it
+                                        ///< overrides, as an inherited overload set is ambiguous.
+    CorePinning corePinning_{CorePinning::Remap};        ///< How the workers are pinned to logicalCore_.
+    std::size_t falseSharingPadding_{CACHE_LINE_SIZE};        ///< Alignment of the fields of the queue, the
+                                                              ///< channels of every kind, the doorbells and
+                                                              ///< the broadcast channels which are written
+                                                              ///< by different threads.
 
     inline constexpr std::size_t outDegree(std::size_t worker) const noexcept;
     inline constexpr std::size_t inDegree(std::size_t worker) const noexcept;
@@ -63,8 +148,11 @@ struct QNetwork {
     constexpr void setDefaultMaxPushAttempts();
     constexpr void setDefaultLogicalCores();
     constexpr void setDefaultEnqueueFrequency();
+    constexpr void roundUpChannelBufferSize();
 
     constexpr void assignTargetPorts();
+    constexpr void mergeInPorts(const std::size_t producersPerPort = 0U);
+    constexpr void setDrainQuotasFromMultiplicities(const std::size_t batchesPerMultiplicity = 1U);
     constexpr void changeToSelfPushLabels();
 
     constexpr bool hasPathToAllWorkers(std::size_t worker) const;
@@ -80,6 +168,7 @@ struct QNetwork {
     constexpr bool hasHomogeneousPorts() const;
     constexpr bool hasHomogeneousBatchSize() const;
     constexpr bool hasSeparateLogicalCores() const;
+    constexpr bool hasBoundedDraining() const;
 
     void printQNetwork() const;
 
@@ -150,6 +239,16 @@ constexpr void QNetwork<workers, channels>::setDefaultChannelBufferSize() {
     channelBufferSize_ = std::max(maxBatchSize() * 8U, enqueueFrequency_ * 4U);
 }
 
+/**
+ * @brief Rounds the channel buffer size up to the next power of two, so that the RingBuffer channels can use
+ * mask instead of modulo arithmetic.
+ *
+ */
+template <std::size_t workers, std::size_t channels>
+constexpr void QNetwork<workers, channels>::roundUpChannelBufferSize() {
+    channelBufferSize_ = std::bit_ceil(channelBufferSize_);
+}
+
 template <std::size_t workers, std::size_t channels>
 constexpr void QNetwork<workers, channels>::setDefaultMaxPushAttempts() {
     maxPushAttempts_ = 4U;
@@ -169,6 +268,50 @@ constexpr void QNetwork<workers, channels>::assignTargetPorts() {
     }
 }
 
+/**
+ * @brief Merges the incomming channels of every worker into shared multi-producer ports. The incomming
+ * channels of a worker are, in the order of the network CSR, grouped into ports of at most producersPerPort
+ * channels. Polling and channel memory then scale with the number of ports rather than the number of
+ * producers. Shared ports require multi-producer channels, hence the channel kind is set to MPSCRing.
+ *
+ * @param producersPerPort Maximal number of channels sharing a port. Zero merges all incomming channels of a
+ * worker into a single port.
+ */
+template <std::size_t workers, std::size_t channels>
+constexpr void QNetwork<workers, channels>::mergeInPorts(const std::size_t producersPerPort) {
+    const std::size_t groupSize = producersPerPort == 0U ? numChannels_ : producersPerPort;
+
+    std::array<std::size_t, workers> numInChannels;
+    for (std::size_t i = 0U; i < numInChannels.size(); ++i) { numInChannels[i] = 0U; }
+
+    for (std::size_t worker = 0U; worker < numWorkers_; ++worker) {
+        for (std::size_t edge = vertexPointer_[worker]; edge < vertexPointer_[worker + 1U]; ++edge) {
+            const std::size_t tgt = edgeTargets_[edge] == numWorkers_ ? worker : edgeTargets_[edge];
+            targetPort_[edge] = numInChannels[tgt]++ / groupSize;
+        }
+    }
+
+    for (std::size_t worker = 0U; worker < numWorkers_; ++worker) {
+        numPorts_[worker] = (numInChannels[worker] + groupSize - 1U) / groupSize;
+    }
+
+    if (groupSize > 1U) { channelKind_ = ChannelKind::MPSCRing; }
+}
+
+/**
+ * @brief Sets the drain quota of every channel to its share of the work, that is its multiplicity times its
+ * batch size, such that ports are drained in proportion to the traffic they are meant to carry.
+ *
+ * @param batchesPerMultiplicity Number of batches a port may deliver per check and unit of multiplicity.
+ */
+template <std::size_t workers, std::size_t channels>
+constexpr void QNetwork<workers, channels>::setDrainQuotasFromMultiplicities(
+    const std::size_t batchesPerMultiplicity) {
+    for (std::size_t channel = 0U; channel < numChannels_; ++channel) {
+        drainQuota_[channel] = multiplicities_[channel] * batchSize_[channel] * batchesPerMultiplicity;
+    }
+}
+
 template <std::size_t workers, std::size_t channels>
 constexpr void QNetwork<workers, channels>::changeToSelfPushLabels() {
     for (std::size_t worker = 0U; worker < numWorkers_; ++worker) {
@@ -223,7 +366,9 @@ constexpr bool QNetwork<workers, channels>::isValidQNetwork() const {
                                                                                edgeTargets_[channel];
 
                 if (tgt == worker) {
-                    if (portOccupied[targetPort_[channel]]) { return false; }
+                    if (portOccupied[targetPort_[channel]] && channelKind_ != ChannelKind::MPSCRing) {
+                        return false;
+                    }
                     portOccupied[targetPort_[channel]] = true;
                 }
             }
@@ -237,6 +382,9 @@ constexpr bool QNetwork<workers, channels>::isValidQNetwork() const {
     if (channelBufferSize_ < maxBatchSize()) { return false; }
     if (maxPushAttempts_ == 0U) { return false; }
     if (enqueueFrequency_ == 0U) { return false; }
+    if (processBatchSize_ == 0U) { return false; }
+    if (not std::has_single_bit(falseSharingPadding_)) { return false; }
+    if (falseSharingPadding_ < alignof(std::size_t)) { return false; }
 
     return true;
 }
@@ -252,6 +400,40 @@ void QNetwork<workers, channels>::printQNetwork() const {
     std::cout << singleIndent << "EnQFreq  : " << enqueueFrequency_ << "\n";
     std::cout << singleIndent << "ChanlSize: " << channelBufferSize_ << "\n";
     std::cout << singleIndent << "MaxAttmps: " << maxPushAttempts_ << "\n";
+    std::cout << singleIndent << "ChanlKind: ";
+    switch (channelKind_) {
+        case ChannelKind::SPSCRing: std::cout << "SPSC\n"; break;
+        case ChannelKind::MPSCRing: std::cout << "MPSC\n"; break;
+        case ChannelKind::SPSCSegmented: std::cout << "SPSC segmented\n"; break;
+        case ChannelKind::SPSCRecord: std::cout << "SPSC record\n"; break;
+    }
+    std::cout << singleIndent << "Streaming: " << (streamingPushes_ ? "yes" : "no") << "\n";
+    std::cout << singleIndent << "BcastSize: " << broadcastBufferSize_ << "\n";
+    std::cout << singleIndent << "Doorbells: " << (portDoorbells_ ? "yes" : "no") << "\n";
+    std::cout << singleIndent << "DrainBdgt: " << drainBudget_ << "\n";
+    std::cout << singleIndent << "ProcBatch: " << processBatchSize_ << "\n";
+    std::cout << singleIndent << "Contin.  : " << (continuations_ ? "yes" : "no") << "\n";
+    std::cout << singleIndent << "Idle     : ";
+    switch (idlePolicy_) {
+        case IdlePolicy::Spin: std::cout << "spin\n"; break;
+        case IdlePolicy::Backoff: std::cout << "backoff\n"; break;
+        case IdlePolicy::Yield: std::cout << "yield\n"; break;
+        case IdlePolicy::Park: std::cout << "park\n"; break;
+    }
+    std::cout << singleIndent << "Terminat.: ";
+    switch (termination_) {
+        case TerminationDetection::GlobalCount: std::cout << "global count\n"; break;
+        case TerminationDetection::Quiescence: std::cout << "quiescence\n"; break;
+    }
+    std::cout << singleIndent << "Persist. : " << (persistentWorkers_ ? "yes" : "no") << "\n";
+    std::cout << singleIndent << "StaticDsp: " << (staticDispatch_ ? "yes" : "no") << "\n";
+    std::cout << singleIndent << "Pinning  : ";
+    switch (corePinning_) {
+        case CorePinning::Strict: std::cout << "strict\n"; break;
+        case CorePinning::Remap: std::cout << "remap\n"; break;
+        case CorePinning::Unpinned: std::cout << "unpinned\n"; break;
+    }
+    std::cout << singleIndent << "Padding:   " << falseSharingPadding_ << "\n";
 
     std::cout << "\n" << singleIndent << "Linking:\n";
     for (std::size_t i = 0U; i < numWorkers_; ++i) {
@@ -281,6 +463,14 @@ void QNetwork<workers, channels>::printQNetwork() const {
             if (j < vertexPointer_[i + 1U] - 1U) { std::cout << ", "; }
         }
         std::cout << "\n";
+
+        std::cout << doubleIndent << "Quotas: ";
+        for (std::size_t j = vertexPointer_[i]; j < vertexPointer_[i + 1U]; ++j) {
+            const std::size_t quota = drainQuota_[j];
+            std::cout << quota;
+            if (j < vertexPointer_[i + 1U] - 1U) { std::cout << ", "; }
+        }
+        std::cout << "\n";
         std::cout << "\n";
     }
 }
@@ -362,6 +552,18 @@ constexpr bool QNetwork<workers, channels>::hasSeparateLogicalCores() const {
     return true;
 }
 
+/**
+ * @brief Whether the workers limit the number of tasks taken from their incomming channels per check.
+ *
+ */
+template <std::size_t workers, std::size_t channels>
+constexpr bool QNetwork<workers, channels>::hasBoundedDraining() const {
+    return (drainBudget_ > 0U)
+           || std::any_of(drainQuota_.cbegin(), drainQuota_.cend(), [](const std::size_t quota) {
+                  return quota > 0U;
+              });
+}
+
 template <std::size_t workers, std::size_t channels>
 constexpr QNetwork<workers, channels>::QNetwork(std::array<std::size_t, workers + 1U> vertexPointer,
                                                 std::array<std::size_t, channels> edgeTargets,
@@ -18,26 +18,49 @@ limitations under the License.
 
 #pragma once
 
-#include <pthread.h>
-
+#include <algorithm>
+#include <atomic>
 #include <barrier>
+#include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <queue>
+#include <span>
 #include <string>
 #include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "Discrepancy/QNetworkTables.hpp"
 #include "Discrepancy/TableGenerator.hpp"
 #include "SpapQueueWorker.hpp"
+#include "Topology/CoreMapping.hpp"
 
 namespace spapq {
 
+/**
+ * @brief Message type of the broadcast channels of a SpapQueue with tasks of type T. Tasks which fit into a
+ * lock-free atomic are broadcast as they are, otherwise messages are std::size_t. Specialise to broadcast a
+ * different type, which needs to fit into a lock-free atomic.
+ *
+ */
+template <typename T>
+struct BroadcastMessage {
+    using type = std::size_t;
+};
+
+template <typename T>
+    requires (std::is_trivially_copyable_v<T> && std::atomic<T>::is_always_lock_free)
+struct BroadcastMessage<T> {
+    using type = T;
+};
+
 /**
  * @brief SpapQueue is a lock-free parallel approximate priority queue. To run the queue call\n
  * (1) initQueue, which allocates the workers,\n
@@ -50,6 +73,10 @@ namespace spapq {
  * Once the queue has completed, it can be reused following the same steps. Calling the functions in any other
  * order results in undefined behaviour.
  *
+ * With persistent workers (see QNetwork::persistentWorkers_), the worker threads stay pinned and keep their
+ * local queues and channels after waitProcessFinish, waiting for the next run. Calling initQueue without
+ * arguments then only prepares the next run, whereas passing worker arguments rebuilds the workers.
+ *
  * The queue may be interrupted at any point (by the main thread operating on the queue) by calling
  * requestStop.
  *
@@ -75,6 +102,7 @@ class SpapQueue final {
 
   public:
     using value_type = T;
+    using broadcast_type = BroadcastMessage<T>::type;
     static constexpr QNetwork<netw.numWorkers_, netw.numChannels_> netw_{netw};
 
     template <typename... Args>
@@ -82,11 +110,18 @@ class SpapQueue final {
     void processQueue();
     void waitProcessFinish();
     void requestStop();
+    inline std::chrono::nanoseconds idleTime(const std::size_t workerId) const noexcept;
+    inline const TerminationWrites &terminationWrites(const std::size_t workerId) const noexcept;
+    inline const std::array<std::size_t, netw.numWorkers_> &workerCores() const noexcept;
 
-    inline void pushBeforeProcessing(const value_type val, const std::size_t workerId = 0U) noexcept;
+    inline void pushBeforeProcessing(const value_type &val, const std::size_t workerId = 0U) noexcept;
+    inline void pushBeforeProcessing(value_type &&val, const std::size_t workerId = 0U) noexcept;
+    template <std::size_t channel>
+    [[nodiscard("Push may fail when channel is full or queue has already finished.\n")]] inline bool
+    pushDuringProcessing(const value_type &val) noexcept;
     template <std::size_t channel>
     [[nodiscard("Push may fail when channel is full or queue has already finished.\n")]] inline bool
-    pushDuringProcessing(const value_type val) noexcept;
+    pushDuringProcessing(value_type &&val) noexcept;
 
     SpapQueue() = default;
     SpapQueue(const SpapQueue &other) = delete;
@@ -104,10 +139,56 @@ class SpapQueue final {
         typename WorkerCollectiveHelper<WorkerTemplate, ThisQType, LocalQType, netw.numWorkers_>::template type<>
     >;
 
-    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> globalCount_{
-        0U};        ///< Is zero if and only if there is no task in the queue. Together with all the
-                    ///< localCount_ of workers keeps track of the total number of tasks in the global queue.
-    alignas(CACHE_LINE_SIZE) WorkerCollective workerResources_;        ///< Resources of the workers.
+    static constexpr bool quiescence_ = netw.termination_ == TerminationDetection::Quiescence;
+    static constexpr std::size_t terminatedCount_ = std::numeric_limits<std::size_t>::max();
+
+    alignas(netw.falseSharingPadding_) std::atomic<std::size_t> globalCount_{
+        quiescence_ ? terminatedCount_ :
+                      0U};        ///< Is zero if and only if there is no task in the queue. Together with all
+                                  ///< the localCount_ of workers keeps track of the total number of tasks in
+                                  ///< the global queue. With quiescence detection, it instead counts the tasks
+                                  ///< enqueued from outside the workers and is terminatedCount_ once the
+                                  ///< queue has finished.
+    alignas(netw.falseSharingPadding_) WorkerCollective
+        workerResources_;        ///< Resources of the workers.
+    std::array<BroadcastChannel<broadcast_type,
+                                std::max(netw.broadcastBufferSize_, std::size_t{1U}),
+                                netw.falseSharingPadding_>,
+               (netw.broadcastBufferSize_ > 0U) ? netw.numWorkers_ : 0U>
+        broadcastChannels_;        ///< Broadcast channel written by each worker.
+    std::array<Doorbell<netw.maxPortNum(), netw.falseSharingPadding_>, netw.portDoorbells_ ? netw.numWorkers_ : 0U>
+        doorbells_;        ///< Ports with pending data of each worker.
+
+    /**
+     * @brief Flag on which a worker sleeps while parked.
+     *
+     */
+    struct alignas(netw.falseSharingPadding_) ParkingSpot {
+        std::atomic<std::uint32_t> parked_{0U};
+    };
+
+    std::array<ParkingSpot, (netw.idlePolicy_ == IdlePolicy::Park) ? netw.numWorkers_ : 0U>
+        parkingSpots_;        ///< Parking spot of each worker.
+    alignas(netw.falseSharingPadding_) std::atomic<std::size_t>
+        numParked_{0U};        ///< Number of workers which are parked or about to park.
+    /**
+     * @brief Number of tasks a worker has created and processed, as last published by the worker.
+     *
+     */
+    struct alignas(netw.falseSharingPadding_) TaskTally {
+        std::atomic<std::size_t> created_{0U};
+        std::atomic<std::size_t> processed_{0U};
+    };
+
+    std::array<TaskTally, quiescence_ ? netw.numWorkers_ : 0U> taskTallies_;        ///< Tally of each
+                                                                                    ///< worker.
+    std::array<std::chrono::nanoseconds, netw.numWorkers_> idleTimes_{};        ///< Time each worker spent
+                                                                                ///< without tasks in the
+                                                                                ///< last run.
+    std::array<TerminationWrites, netw.numWorkers_> terminationWrites_{};        ///< Writes of each worker to
+                                                                                 ///< the termination
+                                                                                 ///< detection in the last
+                                                                                 ///< run.
 
     std::atomic<bool> queueActive_{false};        ///< Keeps track whether the queue is active, i.e., whether
                                                   ///< worker threads have been spawned.
@@ -118,15 +199,34 @@ class SpapQueue final {
     std::barrier<> safeToDeallocateSignal_{netw.numWorkers_};        ///< Signal that all workers have finished
                                                                      ///< working and that it is now safe to
                                                                      ///< deallocate the worker resources.
+    std::barrier<> runFinishedSignal_{netw.numWorkers_ + 1};        ///< Signals that all persistent workers
+                                                                    ///< have finished the run.
+    std::stop_source runStop_;        ///< Stops the current run of persistent workers. The stop token of their
+                                      ///< threads instead shuts them down.
+    bool workersAlive_{false};        ///< Whether persistent worker threads have been spawned. Only accessed
+                                      ///< by the thread operating on the queue.
+
+    std::array<std::size_t, netw.numWorkers_> workerCores_{};        ///< CPU each worker is pinned to or
+                                                                     ///< UNPINNED_CORE.
+    bool coreMappingReported_{false};        ///< Whether a remapping of the logical cores has been reported.
 
     std::array<std::jthread, netw.numWorkers_> workers_;        ///< Worker threads.
 
     template <std::size_t N, typename... Args>
     void threadWork(std::stop_token stoken, Args &&...workerArgs);
+    void shutdownWorkers();
+    void mapWorkerCores();
 
     template <class InputIt>
     [[nodiscard("Push may fail when queue is full.\n")]] inline bool pushInternal(
         InputIt first, InputIt last, const std::size_t workerId, const std::size_t port) noexcept;
+    inline QNetworkChannel<value_type, netw> &channelInternal(const std::size_t workerId,
+                                                                            const std::size_t port) noexcept;
+    inline void unpark(const std::size_t workerId) noexcept;
+    inline void unparkAfterPush(const std::size_t workerId) noexcept;
+    inline void unparkAll() noexcept;
+    inline bool isFinished() const noexcept;
+    inline bool detectQuiescence(std::size_t &numFinishAttempts) noexcept;
 
     // Helper functions
     template <std::size_t tupleSize,
@@ -139,7 +239,13 @@ class SpapQueue final {
     template <std::size_t tupleSize,
               bool networkHomogeneousInPorts = netw.hasHomogeneousInPorts(),
               std::enable_if_t<not networkHomogeneousInPorts, bool> = true>
-    inline void pushBeforeProcessingHelper(const value_type val, const std::size_t workerId) noexcept;
+    inline QNetworkChannel<value_type, netw> &channelInternalHelper(
+        const std::size_t workerId, const std::size_t port) noexcept;
+
+    template <std::size_t tupleSize,
+              bool networkHomogeneousInPorts = netw.hasHomogeneousInPorts(),
+              std::enable_if_t<not networkHomogeneousInPorts, bool> = true>
+    inline void pushBeforeProcessingHelper(value_type &&val, const std::size_t workerId) noexcept;
 
     // Static asserts
     static_assert(netw.isValidQNetwork(), "The QNetwork needs to be valid!\n");
@@ -147,10 +253,14 @@ class SpapQueue final {
                   "The local queue type needs to have matching value_type!\n");
     static_assert(isDerivedWorkerResource<WorkerTemplate, ThisQType, LocalQType, netw.numWorkers_>(),
                   "WorkerTemplate must be derived from WorkerResource.\n");
-    static_assert(netw.hasSeparateLogicalCores(), "Workers should be on separate logical Cores.\n");
+    static_assert(netw.corePinning_ == CorePinning::Unpinned || netw.hasSeparateLogicalCores(),
+                  "Workers should be on separate logical Cores.\n");
     static_assert(netw.isStronglyConnected(), "Required to keep all workers busy.\n");
+    static_assert((not netw.continuations_) || ComparableQueue<LocalQType>,
+                  "Continuations require the local queue to expose its value_compare.\n");
     static_assert(std::is_nothrow_default_constructible_v<value_type>);
-    static_assert(std::is_nothrow_copy_constructible_v<value_type>);
+    static_assert(std::is_nothrow_move_constructible_v<value_type>);
+    static_assert(std::is_nothrow_move_assignable_v<value_type>);
 };
 
 // Implementation Details
@@ -161,16 +271,31 @@ class SpapQueue final {
  */
 template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
 void SpapQueue<T, netw, WorkerTemplate, LocalQType>::waitProcessFinish() {
-    for (auto &thread : workers_) {
-        if (thread.joinable()) { thread.join(); }
+    if constexpr (netw.persistentWorkers_) {
+        runFinishedSignal_.arrive_and_wait();
+        runStop_ = std::stop_source();
+    } else {
+        for (auto &thread : workers_) {
+            if (thread.joinable()) { thread.join(); }
+        }
+    }
+    if constexpr (quiescence_) {
+        globalCount_.store(terminatedCount_, std::memory_order_relaxed);        // In case a stop was requested
+        for (TaskTally &tally : taskTallies_) {
+            tally.created_.store(0U, std::memory_order_relaxed);
+            tally.processed_.store(0U, std::memory_order_relaxed);
+        }
+    } else {
+        globalCount_.store(0U, std::memory_order_relaxed);        // In case a stop was requested
     }
-    globalCount_.store(0U, std::memory_order_relaxed);        // In case a stop was requested
     startSignal_.clear(std::memory_order_relaxed);
     queueActive_.store(false, std::memory_order_release);
 }
 
 /**
- * @brief Initialises the queue by allocating resources and the worker thread.
+ * @brief Initialises the queue by allocating resources and the worker thread. Persistent workers are only
+ * spawned on the first call or when worker arguments are passed, otherwise the workers of the previous run
+ * are reused.
  *
  * @param workerArgs Arguments to be forwarded to the workers. Note that arguments passed by reference need to
  * be wrapped by std::ref.
@@ -185,14 +310,43 @@ bool SpapQueue<T, netw, WorkerTemplate, LocalQType>::initQueue(Args &&...workerA
         return false;
     }
 
-    [this, &workerArgs...]<std::size_t... I>(std::index_sequence<I...>) {
-        ((workers_[I] = std::jthread(std::bind_front(&ThisQType::threadWork<I, Args...>, this),
-                                     std::forward<Args>(workerArgs)...)),
-         ...);
-    }(std::make_index_sequence<netw.numWorkers_>{});
+    if constexpr (quiescence_) { globalCount_.store(0U, std::memory_order_relaxed); }
 
-    allocateSignal_.arrive_and_wait();
-    return true;
+    if constexpr (netw.persistentWorkers_) {
+        if (workersAlive_) {
+            if constexpr (sizeof...(Args) == 0U) {
+                allocateSignal_.arrive_and_wait();
+                return true;
+            } else {
+                shutdownWorkers();
+            }
+        }
+    }
+
+    // Persistent workers which require arguments can only be reused without them
+    constexpr bool buildable
+        = (not netw.persistentWorkers_) || (sizeof...(Args) > 0U)
+          || std::is_constructible_v<WorkerTemplate<ThisQType, LocalQType, netw.numPorts_[0U]>,
+                                     ThisQType &,
+                                     decltype(tables::qNetworkTable<netw, 0U>()),
+                                     std::size_t>;
+    if constexpr (buildable) {
+        if constexpr (netw.persistentWorkers_) { workersAlive_ = true; }
+
+        mapWorkerCores();
+        [this, &workerArgs...]<std::size_t... I>(std::index_sequence<I...>) {
+            ((workers_[I] = std::jthread(std::bind_front(&ThisQType::threadWork<I, Args...>, this),
+                                         std::forward<Args>(workerArgs)...)),
+             ...);
+        }(std::make_index_sequence<netw.numWorkers_>{});
+
+        allocateSignal_.arrive_and_wait();
+        return true;
+    } else {
+        std::cerr << "SpapQueue has no persistent workers yet, which need to be built with their arguments!\n";
+        queueActive_.store(false, std::memory_order_release);
+        return false;
+    }
 }
 
 /**
@@ -248,6 +402,35 @@ inline bool SpapQueue<T, netw, WorkerTemplate, LocalQType>::pushInternal(InputIt
     }
 }
 
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+template <std::size_t tupleSize, bool networkHomogeneousInPorts, std::enable_if_t<not networkHomogeneousInPorts, bool>>
+inline QNetworkChannel<T, netw> &SpapQueue<T, netw, WorkerTemplate, LocalQType>::channelInternalHelper(
+    const std::size_t workerId, const std::size_t port) noexcept {
+    static_assert(0 < tupleSize && tupleSize <= netw.numWorkers_);
+    if constexpr (tupleSize == netw.numWorkers_) { assert(workerId < netw.numWorkers_); }
+
+    if constexpr (tupleSize > 1) {
+        if (workerId != (netw.numWorkers_ - tupleSize)) {
+            return channelInternalHelper<tupleSize - 1>(workerId, port);
+        }
+    }
+    return std::get<netw.numWorkers_ - tupleSize>(workerResources_)->inPorts_[port];
+}
+
+/**
+ * @brief Returns the incomming channel of a worker at the given port.
+ *
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+inline QNetworkChannel<T, netw> &SpapQueue<T, netw, WorkerTemplate, LocalQType>::channelInternal(
+    const std::size_t workerId, const std::size_t port) noexcept {
+    if constexpr (netw.hasHomogeneousInPorts()) {
+        return workerResources_[workerId]->inPorts_[port];
+    } else {
+        return channelInternalHelper<netw.numWorkers_>(workerId, port);
+    }
+}
+
 /**
  * @brief Intructions to be executed by the worker.
  *
@@ -259,25 +442,8 @@ template <std::size_t N, typename... Args>
 void SpapQueue<T, netw, WorkerTemplate, LocalQType>::threadWork(std::stop_token stoken, Args &&...workerArgs) {
     static_assert(N < netw.numWorkers_);
 
-    // pinning thread
-    pthread_t self = pthread_self();
-    cpu_set_t cpuset;
-    CPU_ZERO(&cpuset);
-    const std::size_t logicalCore = netw.logicalCore_[N];
-    CPU_SET(logicalCore, &cpuset);
-
-    int rc = pthread_setaffinity_np(self, sizeof(cpu_set_t), &cpuset);
-    if (rc != 0) {
-        const std::string errorMessage = "Call to pthread_setaffinity_np returned error "
-                                         + std::to_string(rc)
-                                         + ".\nFailed to pin worker number "
-                                         + std::to_string(N)
-                                         + "'s thread to logical core "
-                                         + std::to_string(logicalCore)
-                                         + ".\n";
-        std::cerr << errorMessage;
-        std::exit(EXIT_FAILURE);
-    }
+    // pinning thread, the initialising thread reads workerCores_ only after the allocate signal
+    pinWorkerThread(N, workerCores_[N], netw.corePinning_);
 
 #ifdef SPAPQ_DEBUG
     std::cout << "Worker "
@@ -290,9 +456,9 @@ void SpapQueue<T, netw, WorkerTemplate, LocalQType>::threadWork(std::stop_token
 #endif
 
     // init resource
-    WorkerTemplate<ThisQType, LocalQType, netw.numPorts_[N]> resource
-        = WorkerTemplate<ThisQType, LocalQType, netw.numPorts_[N]>(
-            *this, tables::qNetworkTable<netw, N>(), N, std::forward<Args>(workerArgs)...);
+    using WorkerType = WorkerTemplate<ThisQType, LocalQType, netw.numPorts_[N]>;
+    WorkerType resource
+        = WorkerType(*this, tables::qNetworkTable<netw, N>(), N, std::forward<Args>(workerArgs)...);
 
     // set reference
     if constexpr (netw.hasHomogeneousInPorts()) {
@@ -313,13 +479,48 @@ void SpapQueue<T, netw, WorkerTemplate, LocalQType>::threadWork(std::stop_token
 #ifdef SPAPQ_DEBUG
     std::cout << "Worker " + std::to_string(N) + " is waiting for starting signal.\n";
 #endif
-    startSignal_.wait(false, std::memory_order_acquire);
+    // the type of the worker is known, hence its handler is called without going through the virtual table
+    const auto runResource = [&resource](std::stop_token runToken) {
+        if constexpr (not netw.staticDispatch_) {
+            resource.run(runToken);
+        } else if constexpr (netw.processBatchSize_ > 1U) {
+            resource.run(runToken,
+                         [&resource](std::span<value_type> vals) { resource.WorkerType::processBatch(vals); });
+        } else {
+            resource.run(runToken, [&resource](value_type &&val) {
+                resource.WorkerType::processElement(std::move(val));
+            });
+        }
+    };
+
+    if constexpr (netw.persistentWorkers_) {
+        while (true) {
+            startSignal_.wait(false, std::memory_order_acquire);
+            if (stoken.stop_requested()) { break; }
+
+            // run
+#ifdef SPAPQ_DEBUG
+            std::cout << "Worker " + std::to_string(N) + " begins running the queue.\n";
+#endif
+            runResource(runStop_.get_token());
+
+            // await the other workers, such that no more tasks are pushed into the channels, and the next run
+#ifdef SPAPQ_DEBUG
+            std::cout << "Worker " + std::to_string(N) + " has finished and waits for the next run.\n";
+#endif
+            runFinishedSignal_.arrive_and_wait();
+            resource.prepareNextRun();
+            allocateSignal_.arrive_and_wait();
+        }
+    } else {
+        startSignal_.wait(false, std::memory_order_acquire);
 
-    // run
+        // run
 #ifdef SPAPQ_DEBUG
-    std::cout << "Worker " + std::to_string(N) + " begins running the queue.\n";
+        std::cout << "Worker " + std::to_string(N) + " begins running the queue.\n";
 #endif
-    resource.run(stoken);
+        runResource(stoken);
+    }
 
     // signal and await process finished
 #ifdef SPAPQ_DEBUG
@@ -346,15 +547,198 @@ template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> c
 void SpapQueue<T, netw, WorkerTemplate, LocalQType>::requestStop() {
     if (not queueActive_.load(std::memory_order_acquire)) { return; }
 
-    for (auto &workerThread : workers_) { workerThread.request_stop(); }
+    if constexpr (netw.persistentWorkers_) {
+        runStop_.request_stop();
+    } else {
+        for (auto &workerThread : workers_) { workerThread.request_stop(); }
+    }
     processQueue();        // In case worker threads are waiting for start signal
+    if constexpr (netw.idlePolicy_ == IdlePolicy::Park) { unparkAll(); }
+}
+
+/**
+ * @brief Time the worker spent without tasks in the last run of the queue. Only valid after
+ * waitProcessFinish.
+ *
+ * @param workerId Worker id.
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+inline std::chrono::nanoseconds SpapQueue<T, netw, WorkerTemplate, LocalQType>::idleTime(
+    const std::size_t workerId) const noexcept {
+    return idleTimes_[workerId];
+}
+
+/**
+ * @brief Writes of the worker to the cache lines shared for termination detection in the last run of the
+ * queue. Only valid after waitProcessFinish.
+ *
+ * @param workerId Worker id.
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+inline const TerminationWrites &SpapQueue<T, netw, WorkerTemplate, LocalQType>::terminationWrites(
+    const std::size_t workerId) const noexcept {
+    return terminationWrites_[workerId];
+}
+
+/**
+ * @brief CPU each worker has been pinned to, or UNPINNED_CORE, as decided by the pinning mode of the network.
+ * Only valid after initQueue.
+ *
+ * @see CorePinning
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+inline const std::array<std::size_t, netw.numWorkers_> &
+SpapQueue<T, netw, WorkerTemplate, LocalQType>::workerCores() const noexcept {
+    return workerCores_;
+}
+
+/**
+ * @brief Maps the logical cores of the network onto the CPUs the process may run on. A mapping which differs
+ * from the logical cores is reported the first time.
+ *
+ * @see mapLogicalCores
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+void SpapQueue<T, netw, WorkerTemplate, LocalQType>::mapWorkerCores() {
+    const std::vector<std::size_t> logicalCores(netw.logicalCore_.cbegin(), netw.logicalCore_.cend());
+    const std::vector<std::size_t> mapping = mapLogicalCores(logicalCores, allowedCpus(), netw.corePinning_);
+    std::copy(mapping.cbegin(), mapping.cend(), workerCores_.begin());
+
+    if (netw.corePinning_ == CorePinning::Remap && mapping != logicalCores && (not coreMappingReported_)) {
+        std::cerr << "SpapQueue remapped the logical cores of its network onto the allowed CPUs.\n";
+        printCoreMapping(logicalCores, mapping);
+        coreMappingReported_ = true;
+    }
+}
+
+/**
+ * @brief Wakes the worker if it is parked. To be called after making the reason to wake up visible.
+ *
+ * @param workerId Worker id.
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+inline void SpapQueue<T, netw, WorkerTemplate, LocalQType>::unpark(const std::size_t workerId) noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::atomic<std::uint32_t> &parked = parkingSpots_[workerId].parked_;
+    if ((parked.load(std::memory_order_relaxed) == 1U)
+        && (parked.exchange(0U, std::memory_order_release) == 1U)) {
+        parked.notify_one();
+    }
+}
+
+/**
+ * @brief Wakes the worker if it is parked. To be called after pushing to one of its ports. The parking spot is
+ * only looked at while some worker is parked. A worker counts itself as parked before checking its ports
+ * a last time. Hence, a push which is missed by that check sees the count. With doorbells, the ring of the
+ * port is a sequentially consistent read-modify-write, which orders the push before reading the count and
+ * saves the fence.
+ *
+ * @param workerId Worker id.
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+inline void SpapQueue<T, netw, WorkerTemplate, LocalQType>::unparkAfterPush(const std::size_t workerId) noexcept {
+    if constexpr (netw.portDoorbells_) {
+        if (numParked_.load(std::memory_order_seq_cst) == 0U) { return; }
+    } else {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (numParked_.load(std::memory_order_relaxed) == 0U) { return; }
+    }
+    unpark(workerId);
+}
+
+/**
+ * @brief Wakes all parked workers.
+ *
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+inline void SpapQueue<T, netw, WorkerTemplate, LocalQType>::unparkAll() noexcept {
+    for (std::size_t workerId = 0U; workerId < netw.numWorkers_; ++workerId) { unpark(workerId); }
+}
+
+/**
+ * @brief Checks whether the queue has run out of tasks.
+ *
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+inline bool SpapQueue<T, netw, WorkerTemplate, LocalQType>::isFinished() const noexcept {
+    if constexpr (quiescence_) {
+        return globalCount_.load(std::memory_order_acquire) == terminatedCount_;
+    } else {
+        return globalCount_.load(std::memory_order_acquire) == 0U;
+    }
+}
+
+/**
+ * @brief Checks whether every created task has been processed and, if so, marks the queue as finished. All
+ * processed counts are read before any created count. As the tallies only grow, matching sums imply that no
+ * task was left at some point in between, after which no task can be created by the workers. Tasks enqueued
+ * from outside the workers are ruled out by only finishing if globalCount_ has not changed since it has been
+ * read. Since every worker publishes its tally before checking, the last worker to publish sees all tallies.
+ *
+ * @param numFinishAttempts Incremented for every attempt to mark the queue as finished.
+ * @return true If the queue has finished.
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+inline bool SpapQueue<T, netw, WorkerTemplate, LocalQType>::detectQuiescence(
+    std::size_t &numFinishAttempts) noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::size_t numProcessed = 0U;
+    for (const TaskTally &tally : taskTallies_) {
+        numProcessed += tally.processed_.load(std::memory_order_acquire);
+    }
+
+    std::size_t numExternal = globalCount_.load(std::memory_order_acquire);
+    if (numExternal == terminatedCount_) { return true; }
+
+    std::size_t numCreated = numExternal;
+    for (const TaskTally &tally : taskTallies_) { numCreated += tally.created_.load(std::memory_order_acquire); }
+
+    if (numCreated != numProcessed) { return false; }
+
+    ++numFinishAttempts;
+    if (globalCount_.compare_exchange_strong(
+            numExternal, terminatedCount_, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        if constexpr (netw.idlePolicy_ == IdlePolicy::Park) { unparkAll(); }
+        return true;
+    }
+    return numExternal == terminatedCount_;
+}
+
+/**
+ * @brief Shuts down the persistent worker threads, which are awaiting the next run, and destroys the worker
+ * resources.
+ *
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+void SpapQueue<T, netw, WorkerTemplate, LocalQType>::shutdownWorkers() {
+    for (auto &workerThread : workers_) { workerThread.request_stop(); }
+    startSignal_.test_and_set(std::memory_order_release);
+    startSignal_.notify_all();
+    allocateSignal_.arrive_and_wait();
+
+    for (auto &thread : workers_) {
+        if (thread.joinable()) { thread.join(); }
+    }
+    startSignal_.clear(std::memory_order_relaxed);
+    workersAlive_ = false;
 }
 
 template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
 SpapQueue<T, netw, WorkerTemplate, LocalQType>::~SpapQueue() noexcept {
-    queueActive_.store(true, std::memory_order_relaxed);        // Such that nobody else can start the queue
-    requestStop();        // Required because worker threads can be stuck awaiting start signal
-    // Deconstructor of jthread automatically joins the worker threads and thus destroys the worker resources
+    if constexpr (netw.persistentWorkers_) {
+        if (not workersAlive_) { return; }
+        if (queueActive_.load(std::memory_order_acquire)) {
+            requestStop();
+            waitProcessFinish();
+        }
+        shutdownWorkers();
+    } else {
+        queueActive_.store(true, std::memory_order_relaxed);        // Such that nobody else can start the queue
+        requestStop();        // Required because worker threads can be stuck awaiting start signal
+        // Deconstructor of jthread automatically joins the worker threads and thus destroys the worker resources
+    }
 }
 
 template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
@@ -362,19 +746,32 @@ template <std::size_t tupleSize,
           bool networkHomogeneousInPorts,
           std::enable_if_t<not networkHomogeneousInPorts, bool>>
 inline void SpapQueue<T, netw, WorkerTemplate, LocalQType>::pushBeforeProcessingHelper(
-    const value_type val, const std::size_t workerId) noexcept {
+    value_type &&val, const std::size_t workerId) noexcept {
     static_assert(0 < tupleSize && tupleSize <= netw.numWorkers_);
     if constexpr (tupleSize == netw.numWorkers_) { assert(workerId < netw.numWorkers_); }
 
     if (workerId == (netw.numWorkers_ - tupleSize)) {
-        return std::get<netw.numWorkers_ - tupleSize>(workerResources_)->pushUnsafe(val);
+        return std::get<netw.numWorkers_ - tupleSize>(workerResources_)->pushUnsafe(std::move(val));
     } else {
-        if constexpr (tupleSize > 1) { pushBeforeProcessingHelper<tupleSize - 1>(val, workerId); }
+        if constexpr (tupleSize > 1) { pushBeforeProcessingHelper<tupleSize - 1>(std::move(val), workerId); }
     }
 }
 
 /**
- * @brief Enqueues initial tasks into the local queue of a worker. Only to be used after initialisation and
+ * @brief Enqueues a copy of an initial task into the local queue of a worker. Only to be used after
+ * initialisation and before processing the queue.
+ *
+ * @param val Task or queue element.
+ * @param workerId Worker id whose local queue to push to.
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+inline void SpapQueue<T, netw, WorkerTemplate, LocalQType>::pushBeforeProcessing(
+    const value_type &val, const std::size_t workerId) noexcept {
+    pushBeforeProcessing(value_type(val), workerId);
+}
+
+/**
+ * @brief Moves initial tasks into the local queue of a worker. Only to be used after initialisation and
  * before processing the queue.
  *
  * @param val Task or queue element.
@@ -382,18 +779,18 @@ inline void SpapQueue<T, netw, WorkerTemplate, LocalQType>::pushBeforeProcessing
  */
 template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
 inline void SpapQueue<T, netw, WorkerTemplate, LocalQType>::pushBeforeProcessing(
-    const value_type val, const std::size_t workerId) noexcept {
+    value_type &&val, const std::size_t workerId) noexcept {
     if constexpr (netw.hasHomogeneousInPorts()) {
-        workerResources_[workerId]->pushUnsafe(val);
+        workerResources_[workerId]->pushUnsafe(std::move(val));
     } else {
-        pushBeforeProcessingHelper<netw.numWorkers_>(val, workerId);
+        pushBeforeProcessingHelper<netw.numWorkers_>(std::move(val), workerId);
     }
     globalCount_.fetch_add(1U, std::memory_order_release);
 }
 
 /**
- * @brief Enqueues tasks into a self-push channel of the queue. Only to be used after initialisation and
- * during processing the queue.
+ * @brief Enqueues a copy of a task into a self-push channel of the queue. Only to be used after initialisation
+ * and during processing the queue.
  *
  * @tparam channel A self-push channel into which to push.
  * @param val Task or queue element.
@@ -403,30 +800,59 @@ inline void SpapQueue<T, netw, WorkerTemplate, LocalQType>::pushBeforeProcessing
  */
 template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
 template <std::size_t channel>
-inline bool SpapQueue<T, netw, WorkerTemplate, LocalQType>::pushDuringProcessing(const value_type val) noexcept {
+inline bool SpapQueue<T, netw, WorkerTemplate, LocalQType>::pushDuringProcessing(const value_type &val) noexcept {
+    return pushDuringProcessing<channel>(value_type(val));
+}
+
+/**
+ * @brief Moves tasks into a self-push channel of the queue. Only to be used after initialisation and during
+ * processing the queue. The task is left untouched if the push fails.
+ *
+ * @tparam channel A self-push channel into which to push.
+ * @param val Task or queue element.
+ * @return true If push succeeded.
+ * @return false If push failed. This is either because the channel buffer is full or the queue has already
+ * finished.
+ */
+template <typename T, QNetwork netw, template <class, BasicQueue, std::size_t> class WorkerTemplate, BasicQueue LocalQType>
+template <std::size_t channel>
+inline bool SpapQueue<T, netw, WorkerTemplate, LocalQType>::pushDuringProcessing(value_type &&val) noexcept {
     static_assert(channel < netw.numChannels_, "Must be a valid channel in the QNetwork.");
     static_assert(netw.edgeTargets_[channel] == netw.numWorkers_, "Channel must not have a producer.");
 
     bool success = false;
 
+    const auto isRunning = [](const std::size_t count) {
+        if constexpr (quiescence_) {
+            return count != terminatedCount_;
+        } else {
+            return count > 0U;
+        }
+    };
+
     // Checks if queue is still running and if so signals that there is more work to come
     std::size_t prevCount = globalCount_.load(std::memory_order_relaxed);
-    while (prevCount > 0U
+    while (isRunning(prevCount)
            && (not globalCount_.compare_exchange_weak(
                prevCount, prevCount + 1U, std::memory_order_relaxed, std::memory_order_relaxed))) { };
 
     // Only inserts if queue is still running
-    if (prevCount > 0U) {
+    if (isRunning(prevCount)) {
         constexpr std::size_t worker = netw.source(channel);
         constexpr std::size_t port = netw.targetPort_[channel];
 
         if constexpr (netw.hasHomogeneousInPorts()) {
-            success = workerResources_[worker]->push(val, port);
+            success = workerResources_[worker]->push(std::move(val), port);
         } else {
-            success = std::get<worker>(workerResources_)->push(val, port);
+            success = std::get<worker>(workerResources_)->push(std::move(val), port);
         }
 
-        if (not success) { globalCount_.fetch_sub(1U, std::memory_order_relaxed); }
+        if (not success) {
+            const std::size_t count = globalCount_.fetch_sub(1U, std::memory_order_relaxed);
+            if constexpr ((netw.idlePolicy_ == IdlePolicy::Park) && (not quiescence_)) {
+                if (count == 1U) { unparkAll(); }
+            }
+        }
     }
 
     return success;
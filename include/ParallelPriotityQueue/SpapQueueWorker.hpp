@@ -18,16 +18,84 @@ limitations under the License.
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <iterator>
+#include <limits>
+#include <span>
 #include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "Discrepancy/QNetworkTables.hpp"
 #include "Discrepancy/TableGenerator.hpp"
 #include "ParallelPriotityQueue/Concepts/BasicQueue.hpp"
+#include "ParallelPriotityQueue/Concepts/BulkExtractQueue.hpp"
+#include "ParallelPriotityQueue/Concepts/ComparableQueue.hpp"
+#include "ParallelPriotityQueue/Doorbell.hpp"
+#include "ParallelPriotityQueue/PushIterator.hpp"
+#include "ParallelPriotityQueue/QNetwork.hpp"
+#include "RingBuffer/BroadcastChannel.hpp"
+#include "RingBuffer/MPSCRingBuffer.hpp"
+#include "RingBuffer/RecordChannel.hpp"
 #include "RingBuffer/RingBuffer.hpp"
+#include "RingBuffer/SegmentedChannel.hpp"
 
 namespace spapq {
 
+/**
+ * @brief The channel type of the ports of the workers as dictated by the QNetwork.
+ *
+ * @tparam T Type of queue element or task.
+ * @tparam netw QNetwork.
+ *
+ * @see ChannelKind
+ */
+template <typename T, QNetwork netw>
+using QNetworkChannel = std::conditional_t<
+    netw.channelKind_ == ChannelKind::MPSCRing,
+    MPSCRingBuffer<T, netw.channelBufferSize_, netw.falseSharingPadding_>,
+    std::conditional_t<
+        netw.channelKind_ == ChannelKind::SPSCSegmented,
+        SegmentedChannel<T, netw.channelBufferSize_, netw.falseSharingPadding_>,
+        std::conditional_t<netw.channelKind_ == ChannelKind::SPSCRecord,
+                           RecordChannel<T, netw.channelBufferSize_, netw.falseSharingPadding_>,
+                           RingBuffer<T, netw.channelBufferSize_, false, netw.falseSharingPadding_>>>>;
+
+/**
+ * @brief Hints the core that the calling thread is spin-waiting.
+ *
+ */
+inline void cpuRelax() noexcept {
+#if defined(__SSE2__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+/**
+ * @brief Number of writes of a worker to the cache lines shared for termination detection during a run of the
+ * queue.
+ *
+ * @see TerminationDetection
+ */
+struct TerminationWrites {
+    std::size_t countUpdates_{0U};          ///< Updates of the global count, with GlobalCount detection.
+    std::size_t tallyPublishes_{0U};        ///< Publishes of the tally of the worker, with quiescence
+                                            ///< detection.
+    std::size_t finishAttempts_{0U};        ///< Attempts to mark the queue as finished, with quiescence
+                                            ///< detection.
+};
+
 /**
  * @brief A base class for the functionality of the local worker of the (global) sparse parallel approximate
  * priority queue (SpapQueue).
@@ -47,8 +115,25 @@ class WorkerResource {
 
   public:
     using value_type = GlobalQType::value_type;
+    using broadcast_type = GlobalQType::broadcast_type;
 
   private:
+    using ChannelType = QNetworkChannel<value_type, GlobalQType::netw_>;
+    using OutBufferIterator = std::array<value_type, GlobalQType::netw_.maxBatchSize()>::iterator;
+    static constexpr bool streamingPushes_
+        = GlobalQType::netw_.streamingPushes_
+          && requires (ChannelType &channel, OutBufferIterator it) { channel.pushStreaming(it, it); };
+    static constexpr bool useReservations_ = (not streamingPushes_) && requires (ChannelType &channel) {
+        channel.reserve(1U);
+        channel.commit(1U);
+    };
+    static constexpr bool useContinuations_ = GlobalQType::netw_.continuations_;
+    static constexpr IdlePolicy idlePolicy_ = GlobalQType::netw_.idlePolicy_;
+    static constexpr bool quiescence_ = GlobalQType::netw_.termination_ == TerminationDetection::Quiescence;
+    static constexpr std::size_t maxBackoffShift_ = 10U;        ///< Backing off pauses at most
+                                                                ///< 2^maxBackoffShift_ times per poll.
+    static constexpr std::size_t roundsBeforePark_ = 16U;        ///< Polls backing off before parking.
+
     const std::array<std::size_t, tables::maxTableSize<GlobalQType::netw_>()>
         channelIndices_;                                                         ///< Order of outgoing
                                                                                  ///< channels to push to.
@@ -58,6 +143,8 @@ class WorkerResource {
 
     const std::size_t workerId_;        ///< Worker Id in the global queue.
     std::size_t localCount_{0U};        ///< A partial account of the number of tasks in the global queue.
+    std::size_t tasksCreated_{0U};          ///< Number of tasks created, with quiescence detection.
+    std::size_t tasksProcessed_{0U};        ///< Number of tasks processed, with quiescence detection.
     GlobalQType &globalQueue_;          ///< Reference to the global queue.
     typename std::array<value_type, GlobalQType::netw_.maxBatchSize()>::iterator
         bufferPointer_;        ///< Pointer to the next free spot in the outBuffer_.
@@ -66,35 +153,90 @@ class WorkerResource {
     const typename std::array<std::size_t, tables::maxTableSize<GlobalQType::netw_>()>::const_iterator
         channelTableEndPointer_;        ///< Pointer to the end of the channel indices table. Used to unify
                                         ///< the worker type.
+    std::array<std::span<value_type>, 2U> reservation_;        ///< Slots reserved in the current outgoing
+                                                               ///< channel into which tasks are written
+                                                               ///< directly.
+    std::size_t reservationCount_{0U};               ///< Number of tasks written into the reservation_.
+    ChannelType *reservedChannel_{nullptr};        ///< Channel holding the reservation_, nullptr if none.
 
     LocalQType queue_;        ///< Worker local queue.
-    std::array<RingBuffer<value_type, GlobalQType::netw_.channelBufferSize_>, numPorts>
-        inPorts_;        ///< Incomming channels.
+    std::array<ChannelType, numPorts> inPorts_;        ///< Incomming channels.
+    std::array<std::size_t,
+               (GlobalQType::netw_.broadcastBufferSize_ > 0U) ? GlobalQType::netw_.numWorkers_ : 0U>
+        broadcastCursors_;        ///< Read position in the broadcast channel of every worker.
+    std::array<std::size_t, numPorts> portQuota_;        ///< Maximal number of tasks taken from each port per
+                                                         ///< check of the incomming channels.
+    std::size_t drainStartPort_{0U};        ///< Port at which the next check of the incomming channels
+                                            ///< starts.
+    std::array<value_type,
+               (GlobalQType::netw_.processBatchSize_ > 1U) ? GlobalQType::netw_.processBatchSize_ : 0U>
+        processBuffer_;        ///< Top tasks handed to processBatch together.
+    std::array<value_type, useContinuations_ ? 1U : 0U> continuation_;        ///< Child to be run right
+                                                                             ///< after its parent.
+    bool hasContinuation_{false};        ///< Whether continuation_ holds a task.
+    std::size_t idleRounds_{0U};        ///< Number of consecutive polls which found no task.
+    std::chrono::steady_clock::time_point idleStart_;        ///< Time of the first poll which found no task.
+    std::chrono::nanoseconds idleTime_{0};        ///< Total time spent without tasks.
+    TerminationWrites terminationWrites_;        ///< Writes to the cache lines shared for termination
+                                                 ///< detection.
+
+    inline void incrGlobalCount(const std::size_t n = 1U) noexcept;
+    inline void decrGlobalCount(const std::size_t n = 1U) noexcept;
+    inline void publishCreated() noexcept;
+    inline bool tasksRemaining() noexcept;
 
-    inline void incrGlobalCount() noexcept;
-    inline void decrGlobalCount() noexcept;
+    inline void advanceChannelPointer() noexcept;
+    inline void ringDoorbell(const std::size_t targetWorker, const std::size_t port) noexcept;
+    inline void unparkTarget(const std::size_t targetWorker) noexcept;
+    [[nodiscard("Reserve may fail when channel is full.\n")]] inline bool reserveOutChannel() noexcept;
+    inline void commitReservation() noexcept;
 
     [[nodiscard("Push may fail when channel is full.\n")]] inline bool pushOutBuffer() noexcept;
+    template <class InputIt>
+    [[nodiscard("Push may fail when channel is full.\n")]] inline bool pushOutChannel(InputIt first,
+                                                                                      InputIt last) noexcept;
+    inline void routeTask(value_type &&val) noexcept;
+    [[nodiscard("Task is only taken if it qualifies as continuation.\n")]] inline bool takeContinuation(
+        value_type &val) noexcept;
     inline void pushOutBufferSelf(
         const typename std::array<value_type, GlobalQType::netw_.maxBatchSize()>::iterator fromPointer) noexcept;
 
+    inline void idle(const std::stop_token &stoken) noexcept;
+    inline void backoff() noexcept;
+    inline void park(const std::stop_token &stoken) noexcept;
+    inline void stopIdling() noexcept;
+    inline bool hasIncommingTasks() const noexcept;
+
     inline void enqueueInChannels() noexcept;
-    virtual void processElement(const value_type val) noexcept = 0;
+    inline void enqueueInChannelsBounded() noexcept;
+    inline void readBroadcasts() noexcept;
+    inline value_type takeTop() noexcept;
+    inline std::size_t takeTopBatch() noexcept;
+    virtual void processElement(value_type &&val) noexcept = 0;
+    virtual void processBatch(std::span<value_type> vals) noexcept;
+    virtual void processBroadcast([[maybe_unused]] const broadcast_type val) noexcept { };
 
-    [[nodiscard("Push may fail when channel is full.\n")]] inline bool push(const value_type val,
+    [[nodiscard("Push may fail when channel is full.\n")]] inline bool push(value_type &&val,
                                                                             const std::size_t port) noexcept;
     template <class InputIt>
     [[nodiscard("Push may fail when channel is full.\n")]] inline bool push(InputIt first,
                                                                             InputIt last,
                                                                             const std::size_t port) noexcept;
 
-    inline void pushUnsafe(const value_type val) noexcept;
+    inline void pushUnsafe(value_type &&val) noexcept;
 
+    template <class Processor>
+    inline void run(std::stop_token stoken, Processor &&processor) noexcept;
     inline void run(std::stop_token stoken) noexcept;
+    inline void prepareNextRun() noexcept;
 
   protected:
     inline std::size_t workerId() const noexcept;
-    inline void enqueueGlobal(const value_type val) noexcept;
+    inline void enqueueGlobal(const value_type &val) noexcept;
+    inline void enqueueGlobal(value_type &&val) noexcept;
+    template <class InputIt>
+    inline void enqueueGlobal(InputIt first, InputIt last) noexcept;
+    inline void broadcast(const broadcast_type val) noexcept;
 
     template <std::size_t channelIndicesLength, typename... Args>
     constexpr WorkerResource(GlobalQType &globalQueue,
@@ -110,6 +252,33 @@ class WorkerResource {
     virtual ~WorkerResource() = default;
 };
 
+/**
+ * @brief Adapter base for workers which process their tasks by value, i.e., which override
+ * processElement(const value_type) as workers written before the rvalue signature do. The task is moved into
+ * the by-value handler.
+ *
+ * @tparam GlobalQType Type of the global queue which employs/deploys this worker.
+ * @tparam LocalQType Type of the local (worker personal) queue.
+ * @tparam numPorts The number of ports or incomming channels to the worker.
+ *
+ * @see WorkerResource
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+class ByValueWorkerResource : public WorkerResource<GlobalQType, LocalQType, numPorts> {
+    template <typename, QNetwork, template <class, BasicQueue, std::size_t> class, BasicQueue>
+    friend class SpapQueue;
+
+  public:
+    using value_type = WorkerResource<GlobalQType, LocalQType, numPorts>::value_type;
+
+  private:
+    inline void processElement(value_type &&val) noexcept final;
+    virtual void processElement(const value_type val) noexcept = 0;
+
+  protected:
+    using WorkerResource<GlobalQType, LocalQType, numPorts>::WorkerResource;
+};
+
 /**
  * @brief Check whether the worker template of the SpapQueue is derived from the base template WorkerResource.
  *
@@ -173,12 +342,39 @@ constexpr WorkerResource<GlobalQType, LocalQType, numPorts>::WorkerResource(
     bufferPointer_(outBuffer_.begin()),
     channelPointer_(channelIndices_.cbegin()),
     channelTableEndPointer_(std::next(channelIndices_.cbegin(), channelIndicesLength)),
-    queue_(std::forward<Args>(localQargs)...) { }
+    queue_(std::forward<Args>(localQargs)...) {
+    // Broadcasts of earlier runs of the queue are skipped
+    for (std::size_t worker = 0U; worker < broadcastCursors_.size(); ++worker) {
+        broadcastCursors_[worker] = globalQueue_.broadcastChannels_[worker].numPublished();
+    }
+
+    for (std::size_t &quota : portQuota_) { quota = 0U; }
+    for (std::size_t worker = 0U; worker < GlobalQType::netw_.numWorkers_; ++worker) {
+        for (std::size_t channel = GlobalQType::netw_.vertexPointer_[worker];
+             channel < GlobalQType::netw_.vertexPointer_[worker + 1U];
+             ++channel) {
+            const std::size_t edgeTarget = GlobalQType::netw_.edgeTargets_[channel];
+            const std::size_t tgt = edgeTarget == GlobalQType::netw_.numWorkers_ ? worker : edgeTarget;
+            if (tgt != workerId_) { continue; }
+
+            std::size_t &quota = portQuota_[GlobalQType::netw_.targetPort_[channel]];
+            const std::size_t channelQuota = GlobalQType::netw_.drainQuota_[channel];
+            quota = (channelQuota == 0U || quota == std::numeric_limits<std::size_t>::max()) ?
+                        std::numeric_limits<std::size_t>::max() :
+                        quota + channelQuota;
+        }
+    }
+}
 
 template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
-inline bool WorkerResource<GlobalQType, LocalQType, numPorts>::push(const value_type val,
+inline bool WorkerResource<GlobalQType, LocalQType, numPorts>::push(value_type &&val,
                                                                     const std::size_t port) noexcept {
-    return inPorts_[port].push(val);
+    const bool success = inPorts_[port].push(std::move(val));
+    if (success) {
+        ringDoorbell(workerId_, port);
+        if constexpr (idlePolicy_ == IdlePolicy::Park) { globalQueue_.unparkAfterPush(workerId_); }
+    }
+    return success;
 }
 
 template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
@@ -186,20 +382,146 @@ template <class InputIt>
 inline bool WorkerResource<GlobalQType, LocalQType, numPorts>::push(InputIt first,
                                                                     InputIt last,
                                                                     const std::size_t port) noexcept {
-    return inPorts_[port].push(first, last);
+    const bool success = inPorts_[port].push(first, last);
+    if (success) {
+        ringDoorbell(workerId_, port);
+        if constexpr (idlePolicy_ == IdlePolicy::Park) { globalQueue_.unparkAfterPush(workerId_); }
+    }
+    return success;
 }
 
 /**
- * @brief Adds a new task to the global queue.
+ * @brief Adds a copy of a task to the global queue.
  *
  * @param val Task.
  */
 template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
-inline void WorkerResource<GlobalQType, LocalQType, numPorts>::enqueueGlobal(const value_type val) noexcept {
-    assert(bufferPointer_ != outBuffer_.end());
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::enqueueGlobal(const value_type &val) noexcept {
+    enqueueGlobal(value_type(val));
+}
+
+/**
+ * @brief Publishes val to all other workers, which receive it in processBroadcast the next time they check
+ * their incomming channels. Requires a QNetwork with a positive broadcastBufferSize_. Messages a worker has
+ * fallen too far behind on are skipped, hence broadcasts are suited for monotone updates such as bounds.
+ *
+ * @param val Message.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::broadcast(const broadcast_type val) noexcept {
+    static_assert(GlobalQType::netw_.broadcastBufferSize_ > 0U, "Broadcasts are disabled in the QNetwork.\n");
+    globalQueue_.broadcastChannels_[workerId_].publish(val);
+}
 
+/**
+ * @brief Adds a new task to the global queue. The task is moved all the way into the local queue of the
+ * receiving worker without being copied.
+ *
+ * @param val Task.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::enqueueGlobal(value_type &&val) noexcept {
     incrGlobalCount();
-    *bufferPointer_ = val;
+    if constexpr (useContinuations_) {
+        if (takeContinuation(val)) { return; }
+    }
+    routeTask(std::move(val));
+}
+
+/**
+ * @brief Adds the tasks in [first, last) to the global queue with a single update of the count. Whenever the
+ * outbuffer is empty and enough tasks remain, a whole batch is pushed from the range straight into the
+ * current outgoing channel, skipping the outbuffer. Pass std::move_iterator to move the tasks.
+ *
+ * @param first Beginning of the range of tasks.
+ * @param last End of the range of tasks.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+template <class InputIt>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::enqueueGlobal(InputIt first,
+                                                                             InputIt last) noexcept {
+    std::size_t numRemaining = static_cast<std::size_t>(std::distance(first, last));
+    incrGlobalCount(numRemaining);
+
+    while (numRemaining > 0U) {
+        if ((reservedChannel_ == nullptr) && (bufferPointer_ == outBuffer_.begin())) {
+            const std::size_t batch = GlobalQType::netw_.batchSize_[*channelPointer_];
+            if (numRemaining >= batch) {
+                const InputIt sliceEnd = std::next(first, static_cast<std::ptrdiff_t>(batch));
+                if (pushOutChannel(first, sliceEnd)) {
+                    first = sliceEnd;
+                    numRemaining -= batch;
+                    advanceChannelPointer();
+                    continue;
+                }
+            }
+        }
+
+        value_type val(*first);
+        ++first;
+        --numRemaining;
+        if constexpr (useContinuations_) {
+            if (takeContinuation(val)) { continue; }
+        }
+        routeTask(std::move(val));
+    }
+}
+
+/**
+ * @brief Keeps val as the continuation of the task being processed if no continuation is held yet, the
+ * current entry of the channel indices table is the self-push and val is not worse than the top of the local
+ * queue, i.e., would be popped next. The continuation is run right after the current task, skipping the push
+ * into and the pop from the local queue. The continuation fills a slot of the batch of the self-push entry,
+ * such that the share of tasks kept local remains the one of the channel indices table.
+ *
+ * @param val Task, moved from if taken.
+ * @return true If val has been taken as continuation.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline bool WorkerResource<GlobalQType, LocalQType, numPorts>::takeContinuation(value_type &val) noexcept {
+    if (hasContinuation_) { return false; }
+    if (GlobalQType::netw_.edgeTargets_[*channelPointer_] != GlobalQType::netw_.numWorkers_) { return false; }
+    if ((not queue_.empty()) && typename LocalQType::value_compare{}(val, queue_.top())) { return false; }
+
+    continuation_[0U] = std::move(val);
+    hasContinuation_ = true;
+
+    const std::size_t numBuffered
+        = static_cast<std::size_t>(std::distance(outBuffer_.begin(), bufferPointer_));
+    if (numBuffered + 1U >= GlobalQType::netw_.batchSize_[*channelPointer_]) {
+        pushOutBufferSelf(outBuffer_.begin());
+        advanceChannelPointer();
+    }
+    return true;
+}
+
+/**
+ * @brief Sends a task, which has already been counted, towards the current outgoing channel.
+ *
+ * @param val Task.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::routeTask(value_type &&val) noexcept {
+    assert(bufferPointer_ != outBuffer_.end());
+
+    // Writing directly into the outgoing channel if it has room
+    if ((reservedChannel_ != nullptr) || ((bufferPointer_ == outBuffer_.begin()) && reserveOutChannel())) {
+        const std::size_t firstSpanSize = reservation_[0U].size();
+        if (reservationCount_ < firstSpanSize) {
+            reservation_[0U][reservationCount_] = std::move(val);
+        } else {
+            reservation_[1U][reservationCount_ - firstSpanSize] = std::move(val);
+        }
+        ++reservationCount_;
+
+        if (reservationCount_ == firstSpanSize + reservation_[1U].size()) {
+            commitReservation();
+            advanceChannelPointer();
+        }
+        return;
+    }
+
+    *bufferPointer_ = std::move(val);
     ++bufferPointer_;
 
     std::size_t maxAttempts = GlobalQType::netw_.maxPushAttempts_;
@@ -208,12 +530,94 @@ inline void WorkerResource<GlobalQType, LocalQType, numPorts>::enqueueGlobal(con
            && maxAttempts > 0U) {
         if (not pushOutBuffer()) { --maxAttempts; }
 
-        ++channelPointer_;
-        if (channelPointer_ == channelTableEndPointer_) { channelPointer_ = channelIndices_.cbegin(); }
+        advanceChannelPointer();
     }
     if (maxAttempts == 0U) [[unlikely]] { pushOutBufferSelf(outBuffer_.begin()); }
 }
 
+/**
+ * @brief Moves on to the next outgoing channel in the channel indices table.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::advanceChannelPointer() noexcept {
+    ++channelPointer_;
+    if (channelPointer_ == channelTableEndPointer_) { channelPointer_ = channelIndices_.cbegin(); }
+}
+
+/**
+ * @brief Flags port of targetWorker as having pending data if the QNetwork uses doorbells.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::ringDoorbell(const std::size_t targetWorker,
+                                                                            const std::size_t port) noexcept {
+    if constexpr (GlobalQType::netw_.portDoorbells_) { globalQueue_.doorbells_[targetWorker].ring(port); }
+}
+
+/**
+ * @brief Wakes targetWorker after a push to one of its ports if the QNetwork parks idle workers. A worker
+ * pushing to itself is running and is never woken.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::unparkTarget(
+    const std::size_t targetWorker) noexcept {
+    if constexpr (idlePolicy_ == IdlePolicy::Park) {
+        if (targetWorker != workerId_) { globalQueue_.unparkAfterPush(targetWorker); }
+    }
+}
+
+/**
+ * @brief Tries to reserve a whole batch in the current outgoing channel such that tasks can be written into it
+ * directly, bypassing the outbuffer. Self-push channels, channels not supporting reservations and networks
+ * using streaming pushes never reserve.
+ *
+ * @return true If the reservation succeeded.
+ * @return false If the current channel is a self-push channel or does not have enough room.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline bool WorkerResource<GlobalQType, LocalQType, numPorts>::reserveOutChannel() noexcept {
+    assert(reservedChannel_ == nullptr);
+
+    if constexpr (not useReservations_) {
+        return false;
+    } else {
+        const std::size_t targetWorker = GlobalQType::netw_.edgeTargets_[*channelPointer_];
+        if (targetWorker == GlobalQType::netw_.numWorkers_) { return false; }        // self-push
+
+        const std::size_t port = GlobalQType::netw_.targetPort_[*channelPointer_];
+        ChannelType &channel = globalQueue_.channelInternal(targetWorker, port);
+
+        reservation_ = channel.reserve(GlobalQType::netw_.batchSize_[*channelPointer_]);
+        if (reservation_[0U].empty()) { return false; }
+
+        reservedChannel_ = &channel;
+        reservationCount_ = 0U;
+        return true;
+    }
+}
+
+/**
+ * @brief Publishes all tasks written into the current reservation, if any, to the receiving worker.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::commitReservation() noexcept {
+    if constexpr (useReservations_) {
+        if (reservedChannel_ == nullptr) { return; }
+
+        publishCreated();
+        reservedChannel_->commit(reservationCount_);
+        reservedChannel_ = nullptr;
+
+        // The channel pointer only advances once the reservation is committed
+        const std::size_t targetWorker = GlobalQType::netw_.edgeTargets_[*channelPointer_];
+        ringDoorbell(targetWorker, GlobalQType::netw_.targetPort_[*channelPointer_]);
+        unparkTarget(targetWorker);
+    }
+}
+
 /**
  * @brief Pushes the outbuffer to the current outgoing channel.
  *
@@ -234,8 +638,21 @@ inline bool WorkerResource<GlobalQType, LocalQType, numPorts>::pushOutBuffer() n
         pushOutBufferSelf(itBegin);
         successfulPush = true;
     } else {
+        publishCreated();
         const std::size_t port = GlobalQType::netw_.targetPort_[*channelPointer_];
-        successfulPush = globalQueue_.pushInternal(itBegin, bufferPointer_, targetWorker, port);
+        if constexpr (streamingPushes_) {
+            ChannelType &channel = globalQueue_.channelInternal(targetWorker, port);
+            successfulPush = channel.pushStreaming(itBegin, bufferPointer_);
+            if (successfulPush) {
+                ringDoorbell(targetWorker, port);
+                unparkTarget(targetWorker);
+            }
+        } else {
+            successfulPush = globalQueue_.pushInternal(std::make_move_iterator(itBegin),
+                                                       std::make_move_iterator(bufferPointer_),
+                                                       targetWorker,
+                                                       port);
+        }
         if (successfulPush) { bufferPointer_ = itBegin; }
     }
 
@@ -243,42 +660,130 @@ inline bool WorkerResource<GlobalQType, LocalQType, numPorts>::pushOutBuffer() n
 }
 
 /**
- * @brief Pushes all task from (including) fromPointer in the outbuffer to the local queue.
+ * @brief Pushes the tasks in [first, last) to the current outgoing channel, or into the local queue for a
+ * self-push channel.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+template <class InputIt>
+inline bool WorkerResource<GlobalQType, LocalQType, numPorts>::pushOutChannel(InputIt first,
+                                                                              InputIt last) noexcept {
+    const std::size_t targetWorker = GlobalQType::netw_.edgeTargets_[*channelPointer_];
+    if (targetWorker == GlobalQType::netw_.numWorkers_) {        // netw.numWorkers_ is reserved for self-push
+        for (; first != last; ++first) { queue_.push(value_type(*first)); }
+        return true;
+    }
+
+    publishCreated();
+    const std::size_t port = GlobalQType::netw_.targetPort_[*channelPointer_];
+    if constexpr (streamingPushes_) {
+        ChannelType &channel = globalQueue_.channelInternal(targetWorker, port);
+        const bool successfulPush = channel.pushStreaming(first, last);
+        if (successfulPush) {
+            ringDoorbell(targetWorker, port);
+            unparkTarget(targetWorker);
+        }
+        return successfulPush;
+    } else {
+        return globalQueue_.pushInternal(first, last, targetWorker, port);
+    }
+}
+
+/**
+ * @brief Moves all task from (including) fromPointer in the outbuffer to the local queue.
  *
  * @param fromPointer
  */
 template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
 inline void WorkerResource<GlobalQType, LocalQType, numPorts>::pushOutBufferSelf(
     const typename std::array<value_type, GlobalQType::netw_.maxBatchSize()>::iterator fromPointer) noexcept {
-    constexpr bool hasBatchPush
-        = requires (LocalQType &q,
-                    typename std::array<value_type, GlobalQType::netw_.maxBatchSize()>::iterator first,
-                    typename std::array<value_type, GlobalQType::netw_.maxBatchSize()>::iterator last) {
-              q.push(first, last);
-          };
+    using MoveIt
+        = std::move_iterator<typename std::array<value_type, GlobalQType::netw_.maxBatchSize()>::iterator>;
+    constexpr bool hasBatchPush = requires (LocalQType &q, MoveIt first, MoveIt last) { q.push(first, last); };
 
     if constexpr (hasBatchPush) {
-        auto it = fromPointer;
-        queue_.push(it, bufferPointer_);
+        queue_.push(std::make_move_iterator(fromPointer), std::make_move_iterator(bufferPointer_));
     } else {
-        for (auto it = fromPointer; it != bufferPointer_; ++it) { queue_.push(*it); }
+        for (auto it = fromPointer; it != bufferPointer_; ++it) { queue_.push(std::move(*it)); }
     }
     bufferPointer_ = fromPointer;
 }
 
 /**
- * @brief Enqueues all tasks in the incomming channels into the local queue.
+ * @brief Enqueues all tasks in the incomming channels into the local queue. Each channel is drained in a
+ * single batch. With doorbells, only the channels flagged by their producers are drained.
  *
  */
 template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
 inline void WorkerResource<GlobalQType, LocalQType, numPorts>::enqueueInChannels() noexcept {
-    for (auto &portRingBuffer : inPorts_) {
-        std::optional<value_type> data = portRingBuffer.pop();
-        while (data.has_value()) {
-            queue_.push(*data);
-            data = portRingBuffer.pop();
+    if constexpr (GlobalQType::netw_.broadcastBufferSize_ > 0U) { readBroadcasts(); }
+    if constexpr (GlobalQType::netw_.hasBoundedDraining()) {
+        enqueueInChannelsBounded();
+    } else if constexpr (GlobalQType::netw_.portDoorbells_) {
+        globalQueue_.doorbells_[workerId_].answer(
+            [this](const std::size_t port) { inPorts_[port].drain(PushIterator<LocalQType>(queue_)); });
+    } else {
+        for (auto &portRingBuffer : inPorts_) { portRingBuffer.drain(PushIterator<LocalQType>(queue_)); }
+    }
+}
+
+/**
+ * @brief Enqueues tasks from the incomming channels into the local queue, taking at most the quota of each
+ * port and at most the drain budget in total. The ports are visited round robin, starting one port further
+ * on every call, such that a flooded port can neither starve the others nor cause an unbounded burst of
+ * insertions into the local queue. Ports which may still hold tasks are flagged again if doorbells are used.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::enqueueInChannelsBounded() noexcept {
+    std::size_t budget = GlobalQType::netw_.drainBudget_ == 0U ? std::numeric_limits<std::size_t>::max() :
+                                                                 GlobalQType::netw_.drainBudget_;
+
+    std::array<bool, numPorts> pending;
+    if constexpr (GlobalQType::netw_.portDoorbells_) {
+        for (bool &val : pending) { val = false; }
+        globalQueue_.doorbells_[workerId_].answer(
+            [&pending](const std::size_t rungPort) { pending[rungPort] = true; });
+    }
+
+    std::size_t port = drainStartPort_;
+    for (std::size_t i = 0U; i < numPorts; ++i, port = (port + 1U == numPorts) ? 0U : port + 1U) {
+        if constexpr (GlobalQType::netw_.portDoorbells_) {
+            if (not pending[port]) { continue; }
+        }
+
+        const std::size_t limit = std::min(portQuota_[port], budget);
+        const std::size_t numPopped
+            = limit == 0U ? 0U : inPorts_[port].pop(PushIterator<LocalQType>(queue_), limit);
+        budget -= numPopped;
+
+        if constexpr (GlobalQType::netw_.portDoorbells_) {
+            if (numPopped == limit) { ringDoorbell(workerId_, port); }
+        } else {
+            if (budget == 0U) { break; }
         }
     }
+
+    drainStartPort_ = (drainStartPort_ + 1U == numPorts) ? 0U : drainStartPort_ + 1U;
+}
+
+/**
+ * @brief Hands all new broadcasts of the other workers to processBroadcast. Checking a broadcast channel
+ * without new messages only reads a cache line which is shared until the next broadcast.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::readBroadcasts() noexcept {
+    for (std::size_t worker = 0U; worker < broadcastCursors_.size(); ++worker) {
+        if (worker == workerId_) { continue; }
+
+        auto &channel = globalQueue_.broadcastChannels_[worker];
+        if (not channel.hasNew(broadcastCursors_[worker])) { continue; }
+
+        std::array<broadcast_type, GlobalQType::netw_.broadcastBufferSize_> messages;
+        const std::size_t numMessages = channel.read(broadcastCursors_[worker], messages.begin());
+        for (std::size_t i = 0U; i < numMessages; ++i) { processBroadcast(messages[i]); }
+    }
 }
 
 /**
@@ -286,39 +791,270 @@ inline void WorkerResource<GlobalQType, LocalQType, numPorts>::enqueueInChannels
  * been requested via stop token.
  *
  * @param stoken Stop token.
+ * @param processor Callable processing a task, or a std::span of up to processBatchSize_ top tasks if the
+ * QNetwork asks for batches. Called directly, such that a processor which knows the type of the derived
+ * worker can have its handler inlined into the loop.
  */
 template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
-inline void WorkerResource<GlobalQType, LocalQType, numPorts>::run(std::stop_token stoken) noexcept {
+template <class Processor>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::run(std::stop_token stoken,
+                                                                   Processor &&processor) noexcept {
+    constexpr std::size_t batchWidth = GlobalQType::netw_.processBatchSize_;
+    constexpr std::size_t stopCheckPeriod = std::max(128U / batchWidth, std::size_t{1U});
+    constexpr std::size_t enqueuePeriod
+        = std::max(GlobalQType::netw_.enqueueFrequency_ / batchWidth, std::size_t{1U});
+
     std::size_t cntr = 0;
-    while (globalQueue_.globalCount_.load(std::memory_order_acquire) > 0 && (not stoken.stop_requested())) {
+    while (tasksRemaining() && (not stoken.stop_requested())) {
         while ((not queue_.empty())) [[likely]] {
-            if (cntr % 128U == 0U) {
+            if (cntr % stopCheckPeriod == 0U) {
                 if (stoken.stop_requested()) [[unlikely]] { break; }
             }
 
-            if (cntr % GlobalQType::netw_.enqueueFrequency_ == 0U) { enqueueInChannels(); }
+            if (cntr % enqueuePeriod == 0U) { enqueueInChannels(); }
 
-            const value_type val = queue_.top();
-            queue_.pop();
-            processElement(val);
-            decrGlobalCount();
+            if constexpr (batchWidth > 1U) {
+                const std::size_t numTasks = takeTopBatch();
+                processor(std::span<value_type>(processBuffer_.data(), numTasks));
+                decrGlobalCount(numTasks);
+            } else {
+                value_type val = takeTop();
+                queue_.pop();
+                processor(std::move(val));
+                decrGlobalCount();
+            }
 
             ++cntr;
+
+            if constexpr (useContinuations_) {
+                while (hasContinuation_) {
+                    if (cntr % stopCheckPeriod == 0U) {
+                        if (stoken.stop_requested()) [[unlikely]] { break; }
+                    }
+
+                    if (cntr % enqueuePeriod == 0U) { enqueueInChannels(); }
+
+                    value_type val = std::move(continuation_[0U]);
+                    hasContinuation_ = false;
+                    if constexpr (batchWidth > 1U) {
+                        processor(std::span<value_type>(&val, 1U));
+                    } else {
+                        processor(std::move(val));
+                    }
+                    decrGlobalCount();
+
+                    ++cntr;
+                }
+                // A stop has been requested, hence the continuation is handed back to the local queue
+                if (hasContinuation_) {
+                    queue_.push(std::move(continuation_[0U]));
+                    hasContinuation_ = false;
+                }
+            }
         }
         enqueueInChannels();
+        commitReservation();
         pushOutBufferSelf(outBuffer_.begin());
+
+        if (queue_.empty()) {
+            idle(stoken);
+        } else if (idleRounds_ > 0U) {
+            stopIdling();
+        }
+    }
+
+    // A stopped run may leave tasks in the reservation, which are handed over such that the channel is
+    // released
+    commitReservation();
+
+    if (idleRounds_ > 0U) { stopIdling(); }
+    globalQueue_.idleTimes_[workerId_] = idleTime_;
+    globalQueue_.terminationWrites_[workerId_] = terminationWrites_;
+}
+
+/**
+ * @brief Resets the worker of a persistent queue for the next run, keeping its local queue and channels
+ * allocated. Tasks left behind by a stopped run are discarded. Only to be called once all workers have finished
+ * the run.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::prepareNextRun() noexcept {
+    for (auto &portRingBuffer : inPorts_) { portRingBuffer.drain(PushIterator<LocalQType>(queue_)); }
+    while (not queue_.empty()) { queue_.pop(); }
+    if constexpr (GlobalQType::netw_.portDoorbells_) {
+        globalQueue_.doorbells_[workerId_].answer([]([[maybe_unused]] const std::size_t port) { });
+    }
+
+    bufferPointer_ = outBuffer_.begin();
+    hasContinuation_ = false;
+    localCount_ = 0U;
+    tasksCreated_ = 0U;
+    tasksProcessed_ = 0U;
+    idleRounds_ = 0U;
+    idleTime_ = std::chrono::nanoseconds(0);
+    terminationWrites_ = TerminationWrites{};
+
+    // Broadcasts of earlier runs of the queue are skipped
+    for (std::size_t worker = 0U; worker < broadcastCursors_.size(); ++worker) {
+        broadcastCursors_[worker] = globalQueue_.broadcastChannels_[worker].numPublished();
+    }
+}
+
+/**
+ * @brief Called after a poll of the incomming channels found no task. Waits according to the IdlePolicy of
+ * the QNetwork before the next poll.
+ *
+ * @param stoken Stop token.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::idle(const std::stop_token &stoken) noexcept {
+    if (idleRounds_ == 0U) { idleStart_ = std::chrono::steady_clock::now(); }
+    ++idleRounds_;
+
+    if constexpr (idlePolicy_ == IdlePolicy::Backoff) {
+        backoff();
+    } else if constexpr (idlePolicy_ == IdlePolicy::Yield) {
+        std::this_thread::yield();
+    } else if constexpr (idlePolicy_ == IdlePolicy::Park) {
+        if (idleRounds_ <= roundsBeforePark_) {
+            backoff();
+        } else {
+            park(stoken);
+        }
+    }
+}
+
+/**
+ * @brief Pauses the core, doubling the number of pauses with every idle round up to 2^maxBackoffShift_.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::backoff() noexcept {
+    const std::size_t numPauses = std::size_t{1U} << std::min(idleRounds_ - 1U, maxBackoffShift_);
+    for (std::size_t i = 0U; i < numPauses; ++i) { cpuRelax(); }
+}
+
+/**
+ * @brief Sleeps until a producer pushes to one of the ports, the queue finishes or a stop is
+ * requested. The worker announces itself as parked, and counts itself in the number of parked workers which
+ * producers look at first, before checking these conditions a last time. The waking parties change them before
+ * looking for parked workers, both separated by sequentially consistent fences or read-modify-writes, such
+ * that no wake-up is lost.
+ *
+ * @param stoken Stop token.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::park(const std::stop_token &stoken) noexcept {
+    std::atomic<std::uint32_t> &parked = globalQueue_.parkingSpots_[workerId_].parked_;
+    parked.store(1U, std::memory_order_relaxed);
+    globalQueue_.numParked_.fetch_add(1U, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool rung = false;
+    if constexpr (GlobalQType::netw_.portDoorbells_) { rung = globalQueue_.doorbells_[workerId_].rung(); }
+
+    if (rung || hasIncommingTasks() || globalQueue_.isFinished() || stoken.stop_requested()) {
+        parked.store(0U, std::memory_order_relaxed);
+        globalQueue_.numParked_.fetch_sub(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    parked.wait(1U, std::memory_order_acquire);
+    globalQueue_.numParked_.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds the time since the first poll which found no task to the idle time.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::stopIdling() noexcept {
+    idleTime_ += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now()
+                                                                       - idleStart_);
+    idleRounds_ = 0U;
+}
+
+/**
+ * @brief Checks whether any of the incomming channels holds a task.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline bool WorkerResource<GlobalQType, LocalQType, numPorts>::hasIncommingTasks() const noexcept {
+    return std::any_of(
+        inPorts_.cbegin(), inPorts_.cend(), [](const ChannelType &channel) { return not channel.empty(); });
+}
+
+/**
+ * @brief Runs the local worker with processElement dispatched through the virtual table.
+ *
+ * @param stoken Stop token.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::run(std::stop_token stoken) noexcept {
+    if constexpr (GlobalQType::netw_.processBatchSize_ > 1U) {
+        run(stoken, [this](std::span<value_type> vals) { processBatch(vals); });
+    } else {
+        run(stoken, [this](value_type &&val) { processElement(std::move(val)); });
+    }
+}
+
+/**
+ * @brief Processes a batch of top tasks, best first. Only called if the processBatchSize_ of the QNetwork is
+ * larger than one. By default processes each task with processElement; override to vectorise or prefetch
+ * across tasks. The tasks may be moved from.
+ *
+ * @param vals The tasks.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+void WorkerResource<GlobalQType, LocalQType, numPorts>::processBatch(std::span<value_type> vals) noexcept {
+    for (value_type &val : vals) { processElement(std::move(val)); }
+}
+
+/**
+ * @brief Takes the top task out of the local queue ahead of popping it. If the local queue hands out a
+ * reference to its top, the task is moved from, which relies on pop not inspecting the top element (as is the
+ * case for heap based queues such as std::priority_queue).
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline GlobalQType::value_type WorkerResource<GlobalQType, LocalQType, numPorts>::takeTop() noexcept {
+    if constexpr (std::is_lvalue_reference_v<decltype(queue_.top())>) {
+        return std::move(const_cast<value_type &>(queue_.top()));
+    } else {
+        return queue_.top();
     }
 }
 
 /**
- * @brief Pushes a task directly into the local queue. This should never be called when the worker is
+ * @brief Moves up to processBatchSize_ top tasks out of the local queue into processBuffer_, best first. Uses
+ * a bulk extraction if the local queue provides one.
+ *
+ * @return std::size_t Number of tasks taken.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline std::size_t WorkerResource<GlobalQType, LocalQType, numPorts>::takeTopBatch() noexcept {
+    if constexpr (BulkExtractQueue<LocalQType>) {
+        return queue_.extractTop(processBuffer_.data(), processBuffer_.size());
+    } else {
+        std::size_t numTasks = 0U;
+        while (numTasks < processBuffer_.size() && (not queue_.empty())) {
+            processBuffer_[numTasks++] = takeTop();
+            queue_.pop();
+        }
+        return numTasks;
+    }
+}
+
+/**
+ * @brief Moves a task directly into the local queue. This should never be called when the worker is
  * running/processing the global queue.
  *
  * @param val Task.
  */
 template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
-inline void WorkerResource<GlobalQType, LocalQType, numPorts>::pushUnsafe(const value_type val) noexcept {
-    queue_.push(val);
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::pushUnsafe(value_type &&val) noexcept {
+    queue_.push(std::move(val));
 }
 
 /**
@@ -331,13 +1067,19 @@ inline std::size_t WorkerResource<GlobalQType, LocalQType, numPorts>::workerId()
 }
 
 /**
- * @brief Increases the global count by one. Recall the global count is split between globalCount_ in the
- * global queue and localCount_ in all local queues.
+ * @brief Increases the global count by n. Recall the global count is split between globalCount_ in the
+ * global queue and localCount_ in all local queues. With quiescence detection, only the number of created
+ * tasks of the worker is increased.
  *
  */
 template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
-inline void WorkerResource<GlobalQType, LocalQType, numPorts>::incrGlobalCount() noexcept {
-    ++localCount_;
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::incrGlobalCount(const std::size_t n) noexcept {
+    if constexpr (quiescence_) {
+        tasksCreated_ += n;
+        return;
+    }
+
+    localCount_ += n;
     const std::size_t qSize = queue_.size();
     if (localCount_ >= qSize) {
         const std::size_t newLocalCount = qSize / 2;
@@ -345,25 +1087,85 @@ inline void WorkerResource<GlobalQType, LocalQType, numPorts>::incrGlobalCount()
 
         localCount_ = newLocalCount;
         globalQueue_.globalCount_.fetch_add(diff, std::memory_order_relaxed);
+        ++terminationWrites_.countUpdates_;
     }
 }
 
 /**
- * @brief Decreases the global count by one. Recall the global count is split between globalCount_ in the
- * global queue and localCount_ in all local queues.
+ * @brief Decreases the global count by n. Recall the global count is split between globalCount_ in the
+ * global queue and localCount_ in all local queues. With quiescence detection, only the number of processed
+ * tasks of the worker is increased.
  *
  */
 template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
-inline void WorkerResource<GlobalQType, LocalQType, numPorts>::decrGlobalCount() noexcept {
-    if (localCount_ == 0) {
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::decrGlobalCount(const std::size_t n) noexcept {
+    if constexpr (quiescence_) {
+        tasksProcessed_ += n;
+        return;
+    }
+
+    if (localCount_ < n) {
         const std::size_t newLocalCount = queue_.size() / 2;
-        const std::size_t diff = newLocalCount + 1;
+        const std::size_t diff = newLocalCount + n - localCount_;
 
         localCount_ = newLocalCount;
-        globalQueue_.globalCount_.fetch_sub(diff, std::memory_order_relaxed);
+        const std::size_t prevCount = globalQueue_.globalCount_.fetch_sub(diff, std::memory_order_relaxed);
+        ++terminationWrites_.countUpdates_;
+        if constexpr (idlePolicy_ == IdlePolicy::Park) {
+            if (prevCount == diff) { globalQueue_.unparkAll(); }
+        }
+    } else {
+        localCount_ -= n;
+    }
+}
+
+/**
+ * @brief Publishes the number of created tasks if quiescence detection is used. Called before tasks become
+ * visible to other workers, such that a task can never be counted as processed without being counted as
+ * created.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void WorkerResource<GlobalQType, LocalQType, numPorts>::publishCreated() noexcept {
+    if constexpr (quiescence_) {
+        std::atomic<std::size_t> &created = globalQueue_.taskTallies_[workerId_].created_;
+        if (created.load(std::memory_order_relaxed) != tasksCreated_) {
+            created.store(tasksCreated_, std::memory_order_release);
+            ++terminationWrites_.tallyPublishes_;
+        }
+    }
+}
+
+/**
+ * @brief Checks whether the queue still holds tasks. With quiescence detection, the worker first publishes its
+ * tally and then checks the tallies of all workers.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline bool WorkerResource<GlobalQType, LocalQType, numPorts>::tasksRemaining() noexcept {
+    if constexpr (quiescence_) {
+        publishCreated();
+        std::atomic<std::size_t> &processed = globalQueue_.taskTallies_[workerId_].processed_;
+        if (processed.load(std::memory_order_relaxed) != tasksProcessed_) {
+            processed.store(tasksProcessed_, std::memory_order_release);
+            ++terminationWrites_.tallyPublishes_;
+        }
+        return not globalQueue_.detectQuiescence(terminationWrites_.finishAttempts_);
     } else {
-        --localCount_;
+        return globalQueue_.globalCount_.load(std::memory_order_acquire) > 0U;
     }
 }
 
+/**
+ * @brief Moves the task into the by-value processElement. Calling processElement with an rvalue is ambiguous
+ * between the two signatures, hence the by-value one is picked explicitly.
+ *
+ * @param val The task.
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+inline void ByValueWorkerResource<GlobalQType, LocalQType, numPorts>::processElement(value_type &&val) noexcept {
+    using Handler = void (ByValueWorkerResource::*)(const value_type) noexcept;
+    (this->*static_cast<Handler>(&ByValueWorkerResource::processElement))(std::move(val));
+}
+
 }        // end namespace spapq
@@ -18,6 +18,7 @@ limitations under the License.
 
 #pragma once
 
+#include "ParallelPriotityQueue/DynamicSpapQueueWorker.hpp"
 #include "ParallelPriotityQueue/SpapQueueWorker.hpp"
 
 namespace spapq {
@@ -38,7 +39,7 @@ class FibonacciWorker final : public WorkerResource<GlobalQType, LocalQType, num
     using value_type = BaseT::value_type;
 
   protected:
-    inline void processElement(const value_type val) noexcept override {
+    inline void processElement(value_type &&val) noexcept override {
         if (val > 0) { this->enqueueGlobal(val - 1); }
         if (val > 1) { this->enqueueGlobal(val - 2); }
     }
@@ -57,4 +58,36 @@ class FibonacciWorker final : public WorkerResource<GlobalQType, LocalQType, num
     virtual ~FibonacciWorker() = default;
 };
 
+/**
+ * @brief The FibonacciWorker for the DynamicSpapQueue.
+ *
+ * @see FibonacciWorker
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+class DynamicFibonacciWorker final : public DynamicWorkerResource<GlobalQType, LocalQType> {
+    template <typename, template <class, BasicQueue> class, BasicQueue, std::size_t>
+    friend class DynamicSpapQueue;
+
+    using BaseT = DynamicWorkerResource<GlobalQType, LocalQType>;
+    using value_type = BaseT::value_type;
+
+  protected:
+    inline void processElement(value_type &&val) noexcept override {
+        if (val > 0) { this->enqueueGlobal(val - 1); }
+        if (val > 1) { this->enqueueGlobal(val - 2); }
+    }
+
+  public:
+    DynamicFibonacciWorker(GlobalQType &globalQueue,
+                           const std::vector<std::size_t> &channelIndices,
+                           std::size_t workerId) :
+        DynamicWorkerResource<GlobalQType, LocalQType>(globalQueue, channelIndices, workerId){}
+
+    DynamicFibonacciWorker(const DynamicFibonacciWorker &other) = delete;
+    DynamicFibonacciWorker(DynamicFibonacciWorker &&other) = delete;
+    DynamicFibonacciWorker &operator=(const DynamicFibonacciWorker &other) = delete;
+    DynamicFibonacciWorker &operator=(DynamicFibonacciWorker &&other) = delete;
+    virtual ~DynamicFibonacciWorker() = default;
+};
+
 }        // end namespace spapq
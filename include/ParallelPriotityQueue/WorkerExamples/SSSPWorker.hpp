@@ -18,9 +18,13 @@ limitations under the License.
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <cstddef>
+#include <iterator>
 #include <vector>
 
+#include "ParallelPriotityQueue/DynamicSpapQueueWorker.hpp"
 #include "ParallelPriotityQueue/SpapQueueWorker.hpp"
 
 namespace spapq {
@@ -54,6 +58,9 @@ class SSSPWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts
 
     std::vector<std::atomic<distance_type>> &distance_;
 
+    std::array<value_type, GlobalQType::netw_.maxBatchSize()> children_;        ///< Children collected before
+                                                                                 ///< being enqueued together.
+
     inline bool updateDistance(const vertex_type vertex, const distance_type dist) {
         bool ret = false;
         distance_type currDist = distance_[vertex].load(std::memory_order_relaxed);
@@ -65,17 +72,26 @@ class SSSPWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts
     }
 
   protected:
-    inline void processElement(const value_type val) noexcept override {
+    inline void processElement(value_type &&val) noexcept override {
         const distance_type dist = val[0];
         const vertex_type vertex = val[1];
 
         if (dist == distance_[vertex].load(std::memory_order_relaxed)) {
             const distance_type newDist = dist + 1;
+            std::size_t numChildren = 0U;
             for (vertex_type indx = graph_.sourcePointers_[vertex]; indx < graph_.sourcePointers_[vertex + 1];
                  ++indx) {
                 const vertex_type tgt = graph_.edgeTargets_[indx];
-                if (updateDistance(tgt, newDist)) { this->enqueueGlobal({newDist, tgt}); }
+                if (updateDistance(tgt, newDist)) {
+                    children_[numChildren++] = {newDist, tgt};
+                    if (numChildren == children_.size()) {
+                        this->enqueueGlobal(children_.begin(), children_.end());
+                        numChildren = 0U;
+                    }
+                }
             }
+            this->enqueueGlobal(children_.begin(),
+                                std::next(children_.begin(), static_cast<std::ptrdiff_t>(numChildren)));
         }
     }
 
@@ -97,4 +113,77 @@ class SSSPWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts
     virtual ~SSSPWorker() = default;
 };
 
+/**
+ * @brief The SSSPWorker for the DynamicSpapQueue.
+ *
+ * @see SSSPWorker
+ */
+template <typename GlobalQType, BasicQueue LocalQType>
+class DynamicSSSPWorker final : public DynamicWorkerResource<GlobalQType, LocalQType> {
+    template <typename, template <class, BasicQueue> class, BasicQueue, std::size_t>
+    friend class DynamicSpapQueue;
+
+    using BaseT = DynamicWorkerResource<GlobalQType, LocalQType>;
+    using value_type = BaseT::value_type;
+    using distance_type = value_type::value_type;
+    using vertex_type = value_type::value_type;
+
+    const CSRGraph &graph_;
+
+    std::vector<std::atomic<distance_type>> &distance_;
+
+    std::vector<value_type> children_;        ///< Children collected before being enqueued together.
+
+    inline bool updateDistance(const vertex_type vertex, const distance_type dist) {
+        bool ret = false;
+        distance_type currDist = distance_[vertex].load(std::memory_order_relaxed);
+        while ((dist < currDist) & (not ret)) {
+            ret = distance_[vertex].compare_exchange_weak(
+                currDist, dist, std::memory_order_relaxed, std::memory_order_relaxed);
+        }
+        return ret;
+    }
+
+  protected:
+    inline void processElement(value_type &&val) noexcept override {
+        const distance_type dist = val[0];
+        const vertex_type vertex = val[1];
+
+        if (dist == distance_[vertex].load(std::memory_order_relaxed)) {
+            const distance_type newDist = dist + 1;
+            std::size_t numChildren = 0U;
+            for (vertex_type indx = graph_.sourcePointers_[vertex]; indx < graph_.sourcePointers_[vertex + 1];
+                 ++indx) {
+                const vertex_type tgt = graph_.edgeTargets_[indx];
+                if (updateDistance(tgt, newDist)) {
+                    children_[numChildren++] = {newDist, tgt};
+                    if (numChildren == children_.size()) {
+                        this->enqueueGlobal(children_.begin(), children_.end());
+                        numChildren = 0U;
+                    }
+                }
+            }
+            this->enqueueGlobal(children_.begin(),
+                                std::next(children_.begin(), static_cast<std::ptrdiff_t>(numChildren)));
+        }
+    }
+
+  public:
+    DynamicSSSPWorker(GlobalQType &globalQueue,
+                      const std::vector<std::size_t> &channelIndices,
+                      std::size_t workerId,
+                      const CSRGraph &graph,
+                      std::vector<std::atomic<distance_type>> &distance) :
+        DynamicWorkerResource<GlobalQType, LocalQType>(globalQueue, channelIndices, workerId),
+        graph_(graph),
+        distance_(distance),
+        children_(globalQueue.network().maxBatchSize()){}
+
+    DynamicSSSPWorker(const DynamicSSSPWorker &other) = delete;
+    DynamicSSSPWorker(DynamicSSSPWorker &&other) = delete;
+    DynamicSSSPWorker &operator=(const DynamicSSSPWorker &other) = delete;
+    DynamicSSSPWorker &operator=(DynamicSSSPWorker &&other) = delete;
+    virtual ~DynamicSSSPWorker() = default;
+};
+
 }        // end namespace spapq
@@ -0,0 +1,182 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "Configuration/config.hpp"
+
+namespace spapq {
+
+/**
+ * @brief A single-writer multi-reader broadcast channel implemented as a ring buffer on the stack. The
+ * writer never waits: once the channel is full, the oldest message is overwritten. Every reader keeps its own
+ * cursor, such that readers neither contend with each other nor with the writer. Each slot carries the
+ * sequence number of its message, which lets a reader detect that it has been lapped and skip the lost
+ * messages instead of reading torn data.
+ *
+ * @tparam T Data type. Needs to be lock-free atomic, for example a bound or cutoff.
+ * @tparam N Number of messages retained.
+ * @tparam padding Alignment of the slots and of the head counter, which the readers poll.
+ */
+template <typename T, std::size_t N, std::size_t padding = CACHE_LINE_SIZE>
+class alignas(padding) BroadcastChannel {
+  private:
+    /**
+     * @brief A message slot. The sequence is counter + 1 once the message of that counter is complete and
+     * zero while it is being written.
+     *
+     */
+    struct Slot {
+        std::atomic<std::size_t> sequence_{0U};
+        std::atomic<T> value_{};
+    };
+
+    alignas(padding) std::array<Slot, N> slots_;
+    alignas(padding) std::atomic<std::size_t> headCounter_{0U};
+
+    static constexpr bool powerOfTwoCapacity_ = std::has_single_bit(N);
+
+    static inline constexpr std::size_t index(const std::size_t counter) noexcept;
+
+  public:
+    BroadcastChannel() = default;
+    BroadcastChannel(const BroadcastChannel &other) = delete;
+    BroadcastChannel(BroadcastChannel &&other) = delete;
+    BroadcastChannel &operator=(const BroadcastChannel &other) = delete;
+    BroadcastChannel &operator=(BroadcastChannel &&other) = delete;
+    ~BroadcastChannel() = default;
+
+    inline constexpr std::size_t capacity() const noexcept;
+    inline std::size_t numPublished() const noexcept;
+    inline bool hasNew(const std::size_t cursor) const noexcept;
+
+    inline void publish(const T value) noexcept;
+    template <class OutputIt>
+    inline std::size_t read(std::size_t &cursor, OutputIt out) noexcept;
+
+    // assertions
+    static_assert(std::has_single_bit(padding) && padding >= alignof(std::atomic<std::size_t>),
+                  "Padding needs to be a power of two and at least the alignment of the counter!\n");
+    static_assert(N > 0U, "No trivial BroadcastChannels allowed!\n");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free, "Want atomic to be lock free.\n");
+    static_assert(std::atomic<T>::is_always_lock_free, "Broadcast messages need to be lock free atomics.\n");
+    static_assert(std::is_nothrow_default_constructible_v<T>);
+};
+
+// Implementation details
+
+template <typename T, std::size_t N, std::size_t padding>
+inline constexpr std::size_t BroadcastChannel<T, N, padding>::index(const std::size_t counter) noexcept {
+    if constexpr (powerOfTwoCapacity_) {
+        return counter & (N - 1U);
+    } else {
+        return counter % N;
+    }
+}
+
+/**
+ * @brief The number of messages retained for readers.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline constexpr std::size_t BroadcastChannel<T, N, padding>::capacity() const noexcept {
+    return N;
+}
+
+/**
+ * @brief The total number of messages published so far.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline std::size_t BroadcastChannel<T, N, padding>::numPublished() const noexcept {
+    return headCounter_.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Checks whether there are messages beyond cursor. The head is only written on publish, hence this
+ * stays a read of a shared cache line as long as nothing is broadcast.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline bool BroadcastChannel<T, N, padding>::hasNew(const std::size_t cursor) const noexcept {
+    return headCounter_.load(std::memory_order_relaxed) != cursor;
+}
+
+/**
+ * @brief Publishes value to all readers, overwriting the oldest message if the channel is full. Only to be
+ * called by the writer.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline void BroadcastChannel<T, N, padding>::publish(const T value) noexcept {
+    const std::size_t head = headCounter_.load(std::memory_order_relaxed);
+    Slot &slot = slots_[index(head)];
+
+    slot.sequence_.store(0U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.value_.store(value, std::memory_order_relaxed);
+    slot.sequence_.store(head + 1U, std::memory_order_release);
+
+    headCounter_.store(head + 1U, std::memory_order_release);
+}
+
+/**
+ * @brief Reads all messages published since cursor in order to out and advances cursor past them. If the
+ * reader has fallen behind by more than the capacity, the overwritten messages are skipped.
+ *
+ * @param cursor Position of the reader, starting at zero. Owned by the reader.
+ * @param out Beginning of the destination range.
+ * @return std::size_t Number of messages read.
+ */
+template <typename T, std::size_t N, std::size_t padding>
+template <class OutputIt>
+inline std::size_t BroadcastChannel<T, N, padding>::read(std::size_t &cursor, OutputIt out) noexcept {
+    const std::size_t head = headCounter_.load(std::memory_order_acquire);
+    if (head - cursor > N) { cursor = head - N; }
+
+    std::size_t numRead = 0U;
+    while (cursor != head) {
+        const Slot &slot = slots_[index(cursor)];
+
+        const std::size_t sequence = slot.sequence_.load(std::memory_order_acquire);
+        const T value = slot.value_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((sequence != cursor + 1U) || (slot.sequence_.load(std::memory_order_relaxed) != sequence)) {
+            // Lapped by the writer
+            cursor = std::max(cursor + 1U, headCounter_.load(std::memory_order_acquire) - N + 1U);
+            cursor = std::min(cursor, head);
+            continue;
+        }
+
+        *out = value;
+        ++out;
+        ++cursor;
+        ++numRead;
+    }
+    return numRead;
+}
+
+}        // end namespace spapq
@@ -0,0 +1,266 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "Configuration/config.hpp"
+
+namespace spapq {
+
+/**
+ * @brief A single-producer single consumer first-in-first-out queue implemented as a ring buffer on the heap,
+ * whose capacity is only known at run time. Otherwise as RingBuffer, power-of-two capacities use a mask
+ * instead of an integer division.
+ *
+ * @tparam T Data type.
+ * @tparam padding Alignment of the consumer line and the producer line.
+ *
+ * @see RingBuffer
+ */
+template <typename T, std::size_t padding = CACHE_LINE_SIZE>
+class alignas(padding) DynamicRingBuffer {
+  private:
+    const std::size_t capacity_;
+    const bool powerOfTwoCapacity_;
+    const std::unique_ptr<T[]> data_;
+
+    // consumer
+    alignas(padding) std::atomic<std::size_t> tailCounter_;
+    std::size_t cachedHeadCounter_;
+
+    // producer
+    alignas(padding) std::atomic<std::size_t> headCounter_;
+    std::size_t cachedTailCounter_;
+
+    inline std::size_t index(const std::size_t counter) const noexcept;
+
+  public:
+    explicit DynamicRingBuffer(const std::size_t capacity);
+    DynamicRingBuffer(const DynamicRingBuffer &other) = delete;
+    DynamicRingBuffer(DynamicRingBuffer &&other) = delete;
+    DynamicRingBuffer &operator=(const DynamicRingBuffer &other) = delete;
+    DynamicRingBuffer &operator=(DynamicRingBuffer &&other) = delete;
+    ~DynamicRingBuffer() = default;
+
+    inline std::size_t capacity() const noexcept;
+
+    inline bool empty() const noexcept;
+    inline bool full() const noexcept;
+    inline std::size_t occupancy() const noexcept;
+
+    inline std::optional<T> pop() noexcept;
+    template <class OutputIt>
+    inline std::size_t pop(OutputIt out, const std::size_t maxCount) noexcept;
+    template <class OutputIt>
+    inline std::size_t drain(OutputIt out) noexcept;
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(const T &value) noexcept;
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(T &&value) noexcept;
+    template <class InputIt>
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(InputIt first,
+                                                                          InputIt last) noexcept;
+
+    // assertions
+    static_assert(std::has_single_bit(padding) && padding >= alignof(std::atomic<std::size_t>),
+                  "Padding needs to be a power of two and at least the alignment of the counters!\n");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free, "Want atomic to be lock free.\n");
+    static_assert(sizeof(std::size_t) >= 8, "Counters may only wrap around after 2^64 operations.\n");
+    static_assert(std::is_nothrow_default_constructible_v<T>);
+    static_assert(std::is_nothrow_move_constructible_v<T>);
+    static_assert(std::is_nothrow_move_assignable_v<T>);
+};
+
+// Implementation details
+
+/**
+ * @brief Allocates the buffer.
+ *
+ * @param capacity Size or capacity. Needs to be positive.
+ */
+template <typename T, std::size_t padding>
+DynamicRingBuffer<T, padding>::DynamicRingBuffer(const std::size_t capacity) :
+    capacity_(capacity),
+    powerOfTwoCapacity_(std::has_single_bit(capacity)),
+    data_(std::make_unique<T[]>(capacity)),
+    tailCounter_(capacity),
+    cachedHeadCounter_(capacity),
+    headCounter_(capacity),
+    cachedTailCounter_(capacity) {
+    assert(capacity_ > 0U);
+    assert(capacity_ < std::numeric_limits<std::size_t>::max());
+}
+
+/**
+ * @brief Maps a tail or head counter to its position in data_.
+ *
+ */
+template <typename T, std::size_t padding>
+inline std::size_t DynamicRingBuffer<T, padding>::index(const std::size_t counter) const noexcept {
+    if (powerOfTwoCapacity_) {
+        return counter & (capacity_ - 1U);
+    } else {
+        return counter % capacity_;
+    }
+}
+
+/**
+ * @brief The number of elements the DynamicRingBuffer can maximally hold.
+ *
+ */
+template <typename T, std::size_t padding>
+inline std::size_t DynamicRingBuffer<T, padding>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <typename T, std::size_t padding>
+inline bool DynamicRingBuffer<T, padding>::empty() const noexcept {
+    return tailCounter_.load(std::memory_order_relaxed) == headCounter_.load(std::memory_order_acquire);
+}
+
+template <typename T, std::size_t padding>
+inline bool DynamicRingBuffer<T, padding>::full() const noexcept {
+    return tailCounter_.load(std::memory_order_acquire) + capacity_
+           == headCounter_.load(std::memory_order_relaxed);
+}
+
+template <typename T, std::size_t padding>
+inline std::size_t DynamicRingBuffer<T, padding>::occupancy() const noexcept {
+    return headCounter_.load(std::memory_order_acquire) - tailCounter_.load(std::memory_order_acquire);
+}
+
+template <typename T, std::size_t padding>
+inline std::optional<T> DynamicRingBuffer<T, padding>::pop() noexcept {
+    const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
+    if ((cachedHeadCounter_ != tail)
+        || ((cachedHeadCounter_ = headCounter_.load(std::memory_order_acquire)) != tail)) {
+        std::optional<T> val(std::move(data_[index(tail)]));
+        tailCounter_.fetch_add(1U, std::memory_order_release);
+        return val;
+    } else {
+        return std::optional<T>(std::nullopt);
+    }
+}
+
+/**
+ * @brief Batch pop. Claims all available elements, up to maxCount, with a single load of the head and a single
+ * release of the tail. The elements are moved in order to out.
+ *
+ * @param out Beginning of the destination range.
+ * @param maxCount Maximum number of elements to be popped.
+ * @return std::size_t Number of elements popped.
+ */
+template <typename T, std::size_t padding>
+template <class OutputIt>
+inline std::size_t DynamicRingBuffer<T, padding>::pop(OutputIt out, const std::size_t maxCount) noexcept {
+    const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
+    if (cachedHeadCounter_ - tail < maxCount) {
+        cachedHeadCounter_ = headCounter_.load(std::memory_order_acquire);
+    }
+    const std::size_t numElements = std::min(cachedHeadCounter_ - tail, maxCount);
+
+    if (numElements > 0U) {
+        const std::size_t tailIndx = index(tail);
+
+        const std::size_t numElementsFirstPop = std::min(capacity_ - tailIndx, numElements);
+        const std::size_t numElementsSecondPop = numElements - numElementsFirstPop;
+
+        out = std::copy_n(std::make_move_iterator(data_.get() + tailIndx), numElementsFirstPop, out);
+        std::copy_n(std::make_move_iterator(data_.get()), numElementsSecondPop, out);
+
+        tailCounter_.fetch_add(numElements, std::memory_order_release);
+    }
+    return numElements;
+}
+
+/**
+ * @brief Pops all elements currently in the DynamicRingBuffer.
+ *
+ * @param out Beginning of the destination range.
+ * @return std::size_t Number of elements popped.
+ *
+ * @see pop
+ */
+template <typename T, std::size_t padding>
+template <class OutputIt>
+inline std::size_t DynamicRingBuffer<T, padding>::drain(OutputIt out) noexcept {
+    return pop(out, capacity_);
+}
+
+template <typename T, std::size_t padding>
+inline bool DynamicRingBuffer<T, padding>::push(const T &value) noexcept {
+    return push(T(value));
+}
+
+/**
+ * @brief Moves value into the DynamicRingBuffer. The value is left untouched if the push fails.
+ *
+ */
+template <typename T, std::size_t padding>
+inline bool DynamicRingBuffer<T, padding>::push(T &&value) noexcept {
+    const std::size_t head = headCounter_.load(std::memory_order_relaxed);
+    const std::size_t headLoopAround = head - capacity_;
+    const bool nonFull
+        = (cachedTailCounter_ != headLoopAround)
+          || ((cachedTailCounter_ = tailCounter_.load(std::memory_order_acquire)) != headLoopAround);
+    if (nonFull) {
+        data_[index(head)] = std::move(value);
+        headCounter_.fetch_add(1U, std::memory_order_release);
+    }
+    return nonFull;
+}
+
+/**
+ * @brief Batch push. Either all elements in [first, last) are pushed or none. Pass std::move_iterator to move
+ * the elements into the DynamicRingBuffer.
+ *
+ */
+template <typename T, std::size_t padding>
+template <class InputIt>
+inline bool DynamicRingBuffer<T, padding>::push(InputIt first, InputIt last) noexcept {
+    const std::size_t numElements = static_cast<std::size_t>(std::distance(first, last));
+    const std::size_t head = headCounter_.load(std::memory_order_relaxed);
+
+    const std::size_t diff = head - capacity_ + numElements;
+    const bool enoughSpace = (cachedTailCounter_ >= diff)
+                             || ((cachedTailCounter_ = tailCounter_.load(std::memory_order_acquire)) >= diff);
+    if (enoughSpace) {
+        const std::size_t headIndx = index(head);
+
+        const std::size_t numElementsFirstPush = std::min(capacity_ - headIndx, numElements);
+        const std::size_t numElementsSecondPush = numElements - numElementsFirstPush;
+
+        std::copy_n(first, numElementsFirstPush, data_.get() + headIndx);
+        std::advance(first, numElementsFirstPush);
+        std::copy_n(first, numElementsSecondPush, data_.get());
+
+        headCounter_.fetch_add(numElements, std::memory_order_release);
+    }
+    return enoughSpace;
+}
+
+}        // end namespace spapq
@@ -0,0 +1,324 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "Configuration/config.hpp"
+
+namespace spapq {
+
+/**
+ * @brief A multi-producer single-consumer first-in-first-out queue implemented as a ring buffer on the stack.
+ * Producers claim slots by a compare-and-swap on the head and publish each slot individually by stamping it,
+ * such that the consumer never waits on a slow producer other than the one owning the next slot.
+ *
+ * @tparam T Data type.
+ * @tparam N Size or capacity.
+ * @tparam padding Alignment of the data, the stamps and each of the two counters. Values below the cache line
+ * size trade false sharing between producers and the consumer for a smaller footprint.
+ *
+ * @see RingBuffer
+ */
+template <typename T, std::size_t N, std::size_t padding = CACHE_LINE_SIZE>
+class alignas(padding) MPSCRingBuffer {
+  private:
+    alignas(padding) std::array<T, N> data_;
+    alignas(padding) std::array<std::atomic<std::size_t>, N> stamps_;        ///< Slot of counter c is
+                                                                             ///< published iff its stamp
+                                                                             ///< is c + 1.
+    alignas(padding) std::atomic<std::size_t> tailCounter_{0U};
+    alignas(padding) std::atomic<std::size_t> headCounter_{0U};
+
+    static constexpr bool powerOfTwoCapacity_ = std::has_single_bit(N);
+
+    static inline constexpr std::size_t index(const std::size_t counter) noexcept;
+
+    [[nodiscard("Claim may fail when queue is full.\n")]] inline bool claim(const std::size_t n,
+                                                                           std::size_t &head) noexcept;
+    inline void publish(const std::size_t head, const std::size_t n) noexcept;
+
+    template <typename U>
+    inline bool pushValue(U &&value) noexcept;
+
+  public:
+    MPSCRingBuffer() noexcept;
+    MPSCRingBuffer(const MPSCRingBuffer &other) = delete;
+    MPSCRingBuffer(MPSCRingBuffer &&other) = delete;
+    MPSCRingBuffer &operator=(const MPSCRingBuffer &other) = delete;
+    MPSCRingBuffer &operator=(MPSCRingBuffer &&other) = delete;
+    ~MPSCRingBuffer() = default;
+
+    inline constexpr std::size_t capacity() const noexcept;
+
+    inline bool empty() const noexcept;
+    inline bool full() const noexcept;
+    inline std::size_t occupancy() const noexcept;
+
+    inline std::optional<T> pop() noexcept;
+    [[nodiscard("Pop may fail when queue is empty.\n")]] inline bool pop(T &out) noexcept;
+    template <class OutputIt>
+    inline std::size_t pop(OutputIt out, const std::size_t maxCount) noexcept;
+    template <class OutputIt>
+    inline std::size_t drain(OutputIt out) noexcept;
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(const T &value) noexcept;
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(T &&value) noexcept;
+    template <class InputIt>
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(InputIt first,
+                                                                          InputIt last) noexcept;
+
+    // assertions
+    static_assert(std::has_single_bit(padding) && padding >= alignof(std::atomic<std::size_t>)
+                      && padding >= alignof(T),
+                  "Padding needs to be a power of two and at least the alignment of the counters and T!\n");
+    static_assert(N > 0U, "No trivial RingBuffers allowed!\n");
+    static_assert(N < std::numeric_limits<std::size_t>::max(),
+                  "Needed to differentiate empty from full RingBuffer.\n");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free, "Want atomic to be lock free.\n");
+    static_assert(std::is_nothrow_default_constructible_v<T>);
+    static_assert(std::is_nothrow_move_constructible_v<T>);
+    static_assert(std::is_nothrow_move_assignable_v<T>);
+
+    // overflow protection
+    // can be commented out if number of inserts will be less than the maximum value of std::size_t
+    static_assert(sizeof(std::size_t) >= 8 || (((std::numeric_limits<std::size_t>::max() - N + 1U) % N == 0U)),
+                  "Modulo operations need to be consistent or number of operations need to be "
+                  "smaller than max value of std::size_t!\n");
+};
+
+// Implementation details
+
+template <typename T, std::size_t N, std::size_t padding>
+MPSCRingBuffer<T, N, padding>::MPSCRingBuffer() noexcept {
+    for (std::atomic<std::size_t> &stamp : stamps_) { stamp.store(0U, std::memory_order_relaxed); }
+}
+
+template <typename T, std::size_t N, std::size_t padding>
+inline constexpr std::size_t MPSCRingBuffer<T, N, padding>::index(const std::size_t counter) noexcept {
+    if constexpr (powerOfTwoCapacity_) {
+        return counter & (N - 1U);
+    } else {
+        return counter % N;
+    }
+};
+
+/**
+ * @brief Claims n consecutive slots for the calling producer. Loading the tail before the head guarantees that
+ * the head is never behind the tail.
+ *
+ * @param n Number of slots.
+ * @param head Set to the counter of the first claimed slot.
+ * @return true If the slots have been claimed.
+ * @return false If there is not enough space.
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline bool MPSCRingBuffer<T, N, padding>::claim(const std::size_t n, std::size_t &head) noexcept {
+    if (n > N) { return false; }
+
+    std::size_t tail = tailCounter_.load(std::memory_order_acquire);
+    head = headCounter_.load(std::memory_order_relaxed);
+    do {
+        if (head - tail > N - n) {
+            tail = tailCounter_.load(std::memory_order_acquire);
+            head = headCounter_.load(std::memory_order_relaxed);
+            if (head - tail > N - n) { return false; }
+        }
+    } while (not headCounter_.compare_exchange_weak(
+        head, head + n, std::memory_order_relaxed, std::memory_order_relaxed));
+
+    return true;
+}
+
+/**
+ * @brief Makes the claimed slots [head, head + n) visible to the consumer.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline void MPSCRingBuffer<T, N, padding>::publish(const std::size_t head, const std::size_t n) noexcept {
+    for (std::size_t counter = head; counter < head + n; ++counter) {
+        stamps_[index(counter)].store(counter + 1U, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief The number of elements the Ringbuffer can maximally hold.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline constexpr std::size_t MPSCRingBuffer<T, N, padding>::capacity() const noexcept {
+    return N;
+};
+
+/**
+ * @brief Checks whether the next element is available to the consumer. Only to be called by the consumer.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline bool MPSCRingBuffer<T, N, padding>::empty() const noexcept {
+    const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
+    return stamps_[index(tail)].load(std::memory_order_acquire) != tail + 1U;
+};
+
+/**
+ * @brief Checks whether all slots are claimed.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline bool MPSCRingBuffer<T, N, padding>::full() const noexcept {
+    return tailCounter_.load(std::memory_order_acquire) + N == headCounter_.load(std::memory_order_relaxed);
+};
+
+/**
+ * @brief Returns the number of claimed slots, including those not yet published.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline std::size_t MPSCRingBuffer<T, N, padding>::occupancy() const noexcept {
+    return headCounter_.load(std::memory_order_acquire) - tailCounter_.load(std::memory_order_acquire);
+};
+
+template <typename T, std::size_t N, std::size_t padding>
+inline std::optional<T> MPSCRingBuffer<T, N, padding>::pop() noexcept {
+    const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
+    const std::size_t pos = index(tail);
+    if (stamps_[pos].load(std::memory_order_acquire) == tail + 1U) {
+        std::optional<T> val(std::move(data_[pos]));
+        tailCounter_.store(tail + 1U, std::memory_order_release);
+        return val;
+    } else {
+        return std::optional<T>(std::nullopt);
+    }
+}
+
+template <typename T, std::size_t N, std::size_t padding>
+inline bool MPSCRingBuffer<T, N, padding>::pop(T &out) noexcept {
+    const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
+    const std::size_t pos = index(tail);
+    const bool hasData = stamps_[pos].load(std::memory_order_acquire) == tail + 1U;
+    if (hasData) {
+        out = std::move(data_[pos]);
+        tailCounter_.store(tail + 1U, std::memory_order_release);
+    }
+    return hasData;
+}
+
+/**
+ * @brief Batch pop. Moves the published elements, up to maxCount, in order to out and releases their slots
+ * with a single store of the tail. Stops at the first slot which has not yet been published.
+ *
+ * @param out Beginning of the destination range.
+ * @param maxCount Maximum number of elements to be popped.
+ * @return std::size_t Number of elements popped.
+ */
+template <typename T, std::size_t N, std::size_t padding>
+template <class OutputIt>
+inline std::size_t MPSCRingBuffer<T, N, padding>::pop(OutputIt out, const std::size_t maxCount) noexcept {
+    const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
+
+    std::size_t counter = tail;
+    while ((counter - tail < maxCount)
+           && (stamps_[index(counter)].load(std::memory_order_acquire) == counter + 1U)) {
+        *out = std::move(data_[index(counter)]);
+        ++out;
+        ++counter;
+    }
+
+    if (counter != tail) { tailCounter_.store(counter, std::memory_order_release); }
+    return counter - tail;
+}
+
+/**
+ * @brief Pops all published elements currently in the RingBuffer.
+ *
+ * @param out Beginning of the destination range.
+ * @return std::size_t Number of elements popped.
+ *
+ * @see pop
+ */
+template <typename T, std::size_t N, std::size_t padding>
+template <class OutputIt>
+inline std::size_t MPSCRingBuffer<T, N, padding>::drain(OutputIt out) noexcept {
+    return pop(out, N);
+}
+
+template <typename T, std::size_t N, std::size_t padding>
+template <typename U>
+inline bool MPSCRingBuffer<T, N, padding>::pushValue(U &&value) noexcept {
+    std::size_t head;
+    const bool success = claim(1U, head);
+    if (success) {
+        data_[index(head)] = std::forward<U>(value);
+        publish(head, 1U);
+    }
+    return success;
+}
+
+template <typename T, std::size_t N, std::size_t padding>
+inline bool MPSCRingBuffer<T, N, padding>::push(const T &value) noexcept {
+    return pushValue(value);
+}
+
+/**
+ * @brief Moves value into the RingBuffer. The value is left untouched if the push fails.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline bool MPSCRingBuffer<T, N, padding>::push(T &&value) noexcept {
+    return pushValue(std::move(value));
+}
+
+/**
+ * @brief Batch push. Either all elements in [first, last) are pushed consecutively or none. Pass
+ * std::move_iterator to move the elements into the RingBuffer.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+template <class InputIt>
+inline bool MPSCRingBuffer<T, N, padding>::push(InputIt first, InputIt last) noexcept {
+    const std::size_t numElements = static_cast<std::size_t>(std::distance(first, last));
+
+    std::size_t head;
+    const bool success = claim(numElements, head);
+    if (success) {
+        const std::size_t headIndx = index(head);
+
+        const std::size_t numElementsFirstPush = std::min(N - headIndx, numElements);
+        const std::size_t numElementsSecondPush = numElements - numElementsFirstPush;
+
+        auto dataIt = data_.begin();
+        std::advance(dataIt, headIndx);
+        std::copy_n(first, numElementsFirstPush, dataIt);
+
+        std::advance(first, numElementsFirstPush);
+        std::copy_n(first, numElementsSecondPush, data_.begin());
+
+        publish(head, numElements);
+    }
+    return success;
+}
+
+}        // end namespace spapq
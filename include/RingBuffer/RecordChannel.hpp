@@ -0,0 +1,189 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "Configuration/config.hpp"
+#include "ParallelPriotityQueue/Concepts/SerialisableTask.hpp"
+#include "RingBuffer/RecordRingBuffer.hpp"
+
+namespace spapq {
+
+/**
+ * @brief A single-producer single-consumer first-in-first-out queue of tasks of type T which are stored
+ * serialised in a RecordRingBuffer, such that each task only takes up as many bytes as its payload.
+ *
+ * @tparam T Data type. Needs to satisfy SerialisableTask.
+ * @tparam N Size in bytes.
+ * @tparam padding Padding of the underlying RecordRingBuffer.
+ *
+ * @see RecordRingBuffer
+ * @see SerialisableTask
+ */
+template <typename T, std::size_t N, std::size_t padding = CACHE_LINE_SIZE>
+class alignas(padding) RecordChannel {
+  private:
+    RecordRingBuffer<N, padding> records_;
+
+    inline bool write(const T &value) noexcept;
+
+  public:
+    RecordChannel() = default;
+    RecordChannel(const RecordChannel &other) = delete;
+    RecordChannel(RecordChannel &&other) = delete;
+    RecordChannel &operator=(const RecordChannel &other) = delete;
+    RecordChannel &operator=(RecordChannel &&other) = delete;
+    ~RecordChannel() = default;
+
+    inline constexpr std::size_t capacity() const noexcept;
+
+    inline bool empty() const noexcept;
+    inline std::size_t occupancy() const noexcept;
+
+    inline std::optional<T> pop() noexcept;
+    [[nodiscard("Pop may fail when queue is empty.\n")]] inline bool pop(T &out) noexcept;
+    template <class OutputIt>
+    inline std::size_t pop(OutputIt out, const std::size_t maxCount) noexcept;
+    template <class OutputIt>
+    inline std::size_t drain(OutputIt out) noexcept;
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(const T &value) noexcept;
+    template <class InputIt>
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(InputIt first,
+                                                                          InputIt last) noexcept;
+
+    // assertions
+    static_assert(SerialisableTask<T>, "Tasks in a RecordChannel need to be serialisable!\n");
+    static_assert(std::is_nothrow_move_constructible_v<T>);
+    static_assert(std::is_nothrow_move_assignable_v<T>);
+};
+
+// Implementation details
+
+/**
+ * @brief Stages value as a record without publishing it.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline bool RecordChannel<T, N, padding>::write(const T &value) noexcept {
+    return records_.write(static_cast<std::size_t>(value.serialisedSize()),
+                          [&value](std::span<std::byte> record) { value.serialise(record); });
+}
+
+/**
+ * @brief The number of bytes the RecordChannel can maximally hold, including the record headers.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline constexpr std::size_t RecordChannel<T, N, padding>::capacity() const noexcept {
+    return records_.capacity();
+}
+
+template <typename T, std::size_t N, std::size_t padding>
+inline bool RecordChannel<T, N, padding>::empty() const noexcept {
+    return records_.empty();
+}
+
+/**
+ * @brief The number of bytes taken up by the tasks in the RecordChannel.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline std::size_t RecordChannel<T, N, padding>::occupancy() const noexcept {
+    return records_.occupancy();
+}
+
+template <typename T, std::size_t N, std::size_t padding>
+inline std::optional<T> RecordChannel<T, N, padding>::pop() noexcept {
+    std::optional<T> val(std::nullopt);
+    records_.pop([&val](std::span<const std::byte> record) { val.emplace(T::deserialise(record)); }, 1U);
+    return val;
+}
+
+template <typename T, std::size_t N, std::size_t padding>
+inline bool RecordChannel<T, N, padding>::pop(T &out) noexcept {
+    return pop(&out, 1U) == 1U;
+}
+
+/**
+ * @brief Batch pop. Deserialises the available tasks, up to maxCount, in order to out with a single release
+ * of the tail.
+ *
+ * @param out Beginning of the destination range.
+ * @param maxCount Maximum number of tasks to be popped.
+ * @return std::size_t Number of tasks popped.
+ */
+template <typename T, std::size_t N, std::size_t padding>
+template <class OutputIt>
+inline std::size_t RecordChannel<T, N, padding>::pop(OutputIt out, const std::size_t maxCount) noexcept {
+    return records_.pop(
+        [&out](std::span<const std::byte> record) {
+            *out = T::deserialise(record);
+            ++out;
+        },
+        maxCount);
+}
+
+/**
+ * @brief Pops all tasks currently in the RecordChannel.
+ *
+ * @see pop
+ */
+template <typename T, std::size_t N, std::size_t padding>
+template <class OutputIt>
+inline std::size_t RecordChannel<T, N, padding>::drain(OutputIt out) noexcept {
+    return pop(out, std::numeric_limits<std::size_t>::max());
+}
+
+/**
+ * @brief Serialises value into the RecordChannel. The value is left untouched.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+inline bool RecordChannel<T, N, padding>::push(const T &value) noexcept {
+    const bool success = write(value);
+    if (success) { records_.publish(); }
+    return success;
+}
+
+/**
+ * @brief Batch push. Either all tasks in [first, last) are pushed or none. The tasks are published with a
+ * single release of the head.
+ *
+ */
+template <typename T, std::size_t N, std::size_t padding>
+template <class InputIt>
+inline bool RecordChannel<T, N, padding>::push(InputIt first, InputIt last) noexcept {
+    for (; first != last; ++first) {
+        const T &value = *first;
+        if (not write(value)) {
+            records_.discard();
+            return false;
+        }
+    }
+    records_.publish();
+    return true;
+}
+
+}        // end namespace spapq
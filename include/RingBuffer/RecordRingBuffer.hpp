@@ -0,0 +1,310 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <utility>
+
+#include "Configuration/config.hpp"
+
+namespace spapq {
+
+/**
+ * @brief A single-producer single-consumer first-in-first-out queue of variable-length byte records
+ * implemented as a ring buffer on the stack. Each record is a length header followed by its payload, padded
+ * to the alignment of the header. A record never wraps around the end of the buffer; instead the remaining
+ * bytes are skipped by a wrap marker. Records, including their header, are limited to half of the buffer such
+ * that a skipped record always fits once the consumer has caught up. The head and tail live on separate cache
+ * lines and each side caches the counter of the other side, such that the counters only bounce between cores
+ * when a side runs out of records or space.
+ *
+ * The producer stages records with write and makes them visible to the consumer with a single release in
+ * publish, which allows batches of records to be pushed all or nothing.
+ *
+ * @tparam N Size in bytes.
+ * @tparam padding Alignment of the data, the consumer counters and the producer counters.
+ *
+ * @see RingBuffer
+ */
+template <std::size_t N, std::size_t padding = CACHE_LINE_SIZE>
+class alignas(padding) RecordRingBuffer {
+  public:
+    static constexpr std::size_t headerSize_ = sizeof(std::size_t);        ///< Size of the length header and
+                                                                           ///< alignment of the payloads.
+
+  private:
+    static constexpr std::size_t wrapMarker_ = std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t maxRecordBytes_ = (N / 2U / headerSize_) * headerSize_;
+
+    alignas(padding) std::array<std::byte, N> data_;
+    alignas(padding) std::atomic<std::size_t> tailCounter_{0U};
+    std::size_t cachedHeadCounter_{0U};
+    alignas(padding) std::atomic<std::size_t> headCounter_{0U};
+    std::size_t cachedTailCounter_{0U};
+    std::size_t stagedHeadCounter_{0U};        ///< End of the records written but not yet published.
+
+    static constexpr bool powerOfTwoCapacity_ = std::has_single_bit(N);
+
+    static inline constexpr std::size_t index(const std::size_t counter) noexcept;
+    static inline constexpr std::size_t recordSize(const std::size_t numBytes) noexcept;
+
+    inline bool hasSpace(const std::size_t head, const std::size_t numBytes) noexcept;
+    inline void writeHeader(const std::size_t pos, const std::size_t header) noexcept;
+    inline std::size_t readHeader(const std::size_t pos) const noexcept;
+
+  public:
+    RecordRingBuffer() = default;
+    RecordRingBuffer(const RecordRingBuffer &other) = delete;
+    RecordRingBuffer(RecordRingBuffer &&other) = delete;
+    RecordRingBuffer &operator=(const RecordRingBuffer &other) = delete;
+    RecordRingBuffer &operator=(RecordRingBuffer &&other) = delete;
+    ~RecordRingBuffer() = default;
+
+    inline constexpr std::size_t capacity() const noexcept;
+    inline constexpr std::size_t maxRecordSize() const noexcept;
+
+    inline bool empty() const noexcept;
+    inline std::size_t occupancy() const noexcept;
+
+    template <class Reader>
+    inline std::size_t pop(Reader &&reader, const std::size_t maxCount) noexcept;
+    template <class Reader>
+    inline std::size_t drain(Reader &&reader) noexcept;
+
+    template <class Writer>
+    [[nodiscard("Write may fail when queue is full.\n")]] inline bool write(const std::size_t numBytes,
+                                                                            Writer &&writer) noexcept;
+    inline void publish() noexcept;
+    inline void discard() noexcept;
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(
+        std::span<const std::byte> record) noexcept;
+
+    // assertions
+    static_assert(std::has_single_bit(padding) && padding >= alignof(std::atomic<std::size_t>),
+                  "Padding needs to be a power of two and at least the alignment of the counters!\n");
+    static_assert(N >= 4U * headerSize_, "RecordRingBuffer needs to fit at least two records!\n");
+    static_assert(N % headerSize_ == 0U, "Size needs to be a multiple of the header size!\n");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free, "Want atomic to be lock free.\n");
+
+    // overflow protection
+    // can be commented out if number of bytes written will be less than the maximum value of std::size_t
+    static_assert(sizeof(std::size_t) >= 8 || (((std::numeric_limits<std::size_t>::max() - N + 1U) % N == 0U)),
+                  "Modulo operations need to be consistent or number of operations need to be "
+                  "smaller than max value of std::size_t!\n");
+};
+
+// Implementation details
+
+template <std::size_t N, std::size_t padding>
+inline constexpr std::size_t RecordRingBuffer<N, padding>::index(const std::size_t counter) noexcept {
+    if constexpr (powerOfTwoCapacity_) {
+        return counter & (N - 1U);
+    } else {
+        return counter % N;
+    }
+}
+
+/**
+ * @brief Number of bytes occupied by a record with a payload of numBytes, including the header and padding.
+ *
+ */
+template <std::size_t N, std::size_t padding>
+inline constexpr std::size_t RecordRingBuffer<N, padding>::recordSize(const std::size_t numBytes) noexcept {
+    return headerSize_ + ((numBytes + headerSize_ - 1U) / headerSize_) * headerSize_;
+}
+
+template <std::size_t N, std::size_t padding>
+inline bool RecordRingBuffer<N, padding>::hasSpace(const std::size_t head, const std::size_t numBytes) noexcept {
+    return (head + numBytes - cachedTailCounter_ <= N)
+           || (head + numBytes - (cachedTailCounter_ = tailCounter_.load(std::memory_order_acquire)) <= N);
+}
+
+template <std::size_t N, std::size_t padding>
+inline void RecordRingBuffer<N, padding>::writeHeader(const std::size_t pos, const std::size_t header) noexcept {
+    std::memcpy(data_.data() + pos, &header, headerSize_);
+}
+
+template <std::size_t N, std::size_t padding>
+inline std::size_t RecordRingBuffer<N, padding>::readHeader(const std::size_t pos) const noexcept {
+    std::size_t header;
+    std::memcpy(&header, data_.data() + pos, headerSize_);
+    return header;
+}
+
+/**
+ * @brief The number of bytes the RecordRingBuffer can maximally hold, including headers.
+ *
+ */
+template <std::size_t N, std::size_t padding>
+inline constexpr std::size_t RecordRingBuffer<N, padding>::capacity() const noexcept {
+    return N;
+}
+
+/**
+ * @brief The largest payload which fits into the RecordRingBuffer.
+ *
+ */
+template <std::size_t N, std::size_t padding>
+inline constexpr std::size_t RecordRingBuffer<N, padding>::maxRecordSize() const noexcept {
+    return maxRecordBytes_ - headerSize_;
+}
+
+template <std::size_t N, std::size_t padding>
+inline bool RecordRingBuffer<N, padding>::empty() const noexcept {
+    return tailCounter_.load(std::memory_order_relaxed) == headCounter_.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief The number of published bytes in the RecordRingBuffer, including headers, padding and wrap markers.
+ *
+ */
+template <std::size_t N, std::size_t padding>
+inline std::size_t RecordRingBuffer<N, padding>::occupancy() const noexcept {
+    return headCounter_.load(std::memory_order_acquire) - tailCounter_.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Batch pop. Hands the payloads of the published records, up to maxCount, in order to reader and
+ * releases their bytes with a single store of the tail. The head is only reloaded once the records known to
+ * the consumer are exhausted. The payload is only valid during the call of reader.
+ *
+ * @param reader Callable taking a std::span<const std::byte>. Must not throw.
+ * @param maxCount Maximum number of records to be popped.
+ * @return std::size_t Number of records popped.
+ */
+template <std::size_t N, std::size_t padding>
+template <class Reader>
+inline std::size_t RecordRingBuffer<N, padding>::pop(Reader &&reader, const std::size_t maxCount) noexcept {
+    const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
+
+    std::size_t counter = tail;
+    std::size_t numRecords = 0U;
+    bool refreshedHead = false;
+    while (numRecords < maxCount) {
+        if (counter == cachedHeadCounter_) {
+            if (refreshedHead) { break; }
+            cachedHeadCounter_ = headCounter_.load(std::memory_order_acquire);
+            refreshedHead = true;
+            continue;
+        }
+
+        const std::size_t pos = index(counter);
+        const std::size_t header = readHeader(pos);
+        if (header == wrapMarker_) {
+            counter += N - pos;
+            continue;
+        }
+
+        reader(std::span<const std::byte>(data_.data() + pos + headerSize_, header));
+        counter += recordSize(header);
+        ++numRecords;
+    }
+
+    if (counter != tail) { tailCounter_.store(counter, std::memory_order_release); }
+    return numRecords;
+}
+
+/**
+ * @brief Pops all published records currently in the RecordRingBuffer.
+ *
+ * @see pop
+ */
+template <std::size_t N, std::size_t padding>
+template <class Reader>
+inline std::size_t RecordRingBuffer<N, padding>::drain(Reader &&reader) noexcept {
+    return pop(std::forward<Reader>(reader), std::numeric_limits<std::size_t>::max());
+}
+
+/**
+ * @brief Stages a record with a payload of numBytes after the previously staged records. The payload is
+ * written in place by writer. If the record does not fit before the end of the buffer, the remaining bytes
+ * are skipped by a wrap marker. The record is only visible to the consumer after publish.
+ *
+ * @param numBytes Size of the payload.
+ * @param writer Callable taking a std::span<std::byte> of size numBytes. Must not throw.
+ * @return true If the record has been staged.
+ * @return false If there is not enough space.
+ *
+ * @see publish
+ * @see discard
+ */
+template <std::size_t N, std::size_t padding>
+template <class Writer>
+inline bool RecordRingBuffer<N, padding>::write(const std::size_t numBytes, Writer &&writer) noexcept {
+    if (numBytes > maxRecordSize()) { return false; }
+
+    const std::size_t numRecordBytes = recordSize(numBytes);
+    std::size_t head = stagedHeadCounter_;
+    const std::size_t pos = index(head);
+    const std::size_t skip = (N - pos < numRecordBytes) ? N - pos : 0U;
+
+    if (not hasSpace(head, skip + numRecordBytes)) { return false; }
+
+    if (skip > 0U) {
+        writeHeader(pos, wrapMarker_);
+        head += skip;
+    }
+
+    const std::size_t recordPos = index(head);
+    writeHeader(recordPos, numBytes);
+    writer(std::span<std::byte>(data_.data() + recordPos + headerSize_, numBytes));
+
+    stagedHeadCounter_ = head + numRecordBytes;
+    return true;
+}
+
+/**
+ * @brief Makes all staged records visible to the consumer.
+ *
+ */
+template <std::size_t N, std::size_t padding>
+inline void RecordRingBuffer<N, padding>::publish() noexcept {
+    headCounter_.store(stagedHeadCounter_, std::memory_order_release);
+}
+
+/**
+ * @brief Drops all records staged since the last publish.
+ *
+ */
+template <std::size_t N, std::size_t padding>
+inline void RecordRingBuffer<N, padding>::discard() noexcept {
+    stagedHeadCounter_ = headCounter_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Copies record into the RecordRingBuffer and publishes it.
+ *
+ */
+template <std::size_t N, std::size_t padding>
+inline bool RecordRingBuffer<N, padding>::push(std::span<const std::byte> record) noexcept {
+    const bool success = write(record.size(), [&record](std::span<std::byte> slot) {
+        std::copy(record.begin(), record.end(), slot.begin());
+    });
+    if (success) { publish(); }
+    return success;
+}
+
+}        // end namespace spapq
@@ -21,39 +21,65 @@ limitations under the License.
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
 #include <execution>
 #include <iterator>
 #include <limits>
 #include <optional>
+#include <span>
 #include <type_traits>
+#include <utility>
 
 #include "Configuration/config.hpp"
+#include "RingBuffer/StreamingCopy.hpp"
 
 namespace spapq {
 
 /**
  * @brief A single-producer single consumer first-in-first-out queue implemented as a ring buffer on
- * the stack.
+ * the stack. The fields owned by the consumer and those owned by the producer each share a line of the given
+ * padding, such that the bookkeeping costs two lines on top of the data.
  *
  * @tparam T Data type.
  * @tparam N Size or capacity.
+ * @tparam waitable Whether the counters are notified on every change, such that a blocked producer or
+ * consumer can sleep in pushWait and popWait instead of spinning.
+ * @tparam padding Alignment of the data, the consumer line and the producer line. Values below the cache line
+ * size trade false sharing for a smaller footprint.
  */
-template <typename T, std::size_t N>
-class alignas(CACHE_LINE_SIZE) RingBuffer {
+template <typename T, std::size_t N, bool waitable = false, std::size_t padding = CACHE_LINE_SIZE>
+class alignas(padding) RingBuffer {
   private:
-    alignas(CACHE_LINE_SIZE) std::array<T, N> data_;
-    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tailCounter_{N};
-    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> headCounter_{N};
-    alignas(CACHE_LINE_SIZE) std::size_t cachedTailCounter_{N};
-    alignas(CACHE_LINE_SIZE) std::size_t cachedHeadCounter_{N};
-    char padding_[CACHE_LINE_SIZE - sizeof(std::size_t)];
+    alignas(padding) std::array<T, N> data_;
+
+    // consumer
+    alignas(padding) std::atomic<std::size_t> tailCounter_{N};
+    std::size_t cachedHeadCounter_{N};
+
+    // producer
+    alignas(padding) std::atomic<std::size_t> headCounter_{N};
+    std::size_t cachedTailCounter_{N};
 
+    static constexpr bool powerOfTwoCapacity_ = std::has_single_bit(N);
+    static constexpr std::size_t streamingMinBytes_
+        = std::max(padding, CACHE_LINE_SIZE);        ///< Smallest batch in bytes pushed with streaming stores,
+                                                     ///< which covers a line of both the padding of the slots
+                                                     ///< and the cache.
+    static constexpr std::size_t spinsBeforeWait_ = 64U;        ///< Failed attempts before a blocking push or
+                                                                ///< pop goes to sleep.
+
+    static inline constexpr std::size_t index(const std::size_t counter) noexcept;
     inline std::size_t getTailPosition() const noexcept;
     inline std::size_t getHeadPosition() const noexcept;
 
     inline void advanceTail(const std::size_t n = 1U) noexcept;
     inline void advanceHead(const std::size_t n = 1U) noexcept;
 
+    inline bool hasSpace(const std::size_t head, const std::size_t numElements) noexcept;
+
+    template <typename U>
+    inline bool pushValue(U &&value) noexcept;
+
   public:
     RingBuffer() = default;
     RingBuffer(const RingBuffer &other) = delete;
@@ -70,18 +96,47 @@ class alignas(CACHE_LINE_SIZE) RingBuffer {
 
     inline std::optional<T> pop() noexcept;
     [[nodiscard("Pop may fail when queue is empty.\n")]] inline bool pop(T &out) noexcept;
-    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(const T value) noexcept;
+    template <class OutputIt>
+    inline std::size_t pop(OutputIt out, const std::size_t maxCount) noexcept;
+    template <class OutputIt>
+    inline std::size_t drain(OutputIt out) noexcept;
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(const T &value) noexcept;
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(T &&value) noexcept;
     template <class InputIt>
     [[nodiscard("Push may fail when queue is full.\n")]] inline bool push(InputIt first,
                                                                           InputIt last) noexcept;
+    template <class InputIt>
+    [[nodiscard("Push may fail when queue is full.\n")]] inline bool pushStreaming(InputIt first,
+                                                                                   InputIt last) noexcept;
+
+    [[nodiscard("Reserve may fail when queue is full.\n")]] inline std::array<std::span<T>, 2U> reserve(
+        const std::size_t n) noexcept;
+    inline void commit(const std::size_t n) noexcept;
+
+    inline void pushWait(const T &value) noexcept
+        requires waitable;
+    inline void pushWait(T &&value) noexcept
+        requires waitable;
+    template <class InputIt>
+    inline void pushWait(InputIt first, InputIt last) noexcept
+        requires waitable;
+    inline T popWait() noexcept
+        requires waitable;
+    template <class OutputIt>
+    inline std::size_t popWait(OutputIt out, const std::size_t maxCount) noexcept
+        requires waitable;
 
     // assertions
     static_assert(N > 0U, "No trivial RingBuffers allowed!\n");
+    static_assert(std::has_single_bit(padding) && padding >= alignof(std::atomic<std::size_t>)
+                      && padding >= alignof(T),
+                  "Padding needs to be a power of two and at least the alignment of the counters and T!\n");
     static_assert(N < std::numeric_limits<std::size_t>::max(),
                   "Needed to differentiate empty from full RingBuffer.\n");
     static_assert(std::atomic<std::size_t>::is_always_lock_free, "Want atomic to be lock free.\n");
     static_assert(std::is_nothrow_default_constructible_v<T>);
-    static_assert(std::is_nothrow_copy_constructible_v<T>);
+    static_assert(std::is_nothrow_move_constructible_v<T>);
+    static_assert(std::is_nothrow_move_assignable_v<T>);
 
     // overflow protection
     // can be commented out if number of inserts will be less than the maximum value of std::size_t
@@ -94,32 +149,70 @@ class alignas(CACHE_LINE_SIZE) RingBuffer {
 
 // Implementation details
 
-template <typename T, std::size_t N>
-inline std::size_t RingBuffer<T, N>::getTailPosition() const noexcept {
-    return tailCounter_.load(std::memory_order_relaxed) % N;
+/**
+ * @brief Maps a tail or head counter to its position in data_. Power-of-two capacities use a mask instead of
+ * an integer division.
+ *
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline constexpr std::size_t RingBuffer<T, N, waitable, padding>::index(const std::size_t counter) noexcept {
+    if constexpr (powerOfTwoCapacity_) {
+        return counter & (N - 1U);
+    } else {
+        return counter % N;
+    }
 };
 
-template <typename T, std::size_t N>
-inline std::size_t RingBuffer<T, N>::getHeadPosition() const noexcept {
-    return headCounter_.load(std::memory_order_relaxed) % N;
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline std::size_t RingBuffer<T, N, waitable, padding>::getTailPosition() const noexcept {
+    return index(tailCounter_.load(std::memory_order_relaxed));
 };
 
-template <typename T, std::size_t N>
-inline void RingBuffer<T, N>::advanceTail(const std::size_t n) noexcept {
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline std::size_t RingBuffer<T, N, waitable, padding>::getHeadPosition() const noexcept {
+    return index(headCounter_.load(std::memory_order_relaxed));
+};
+
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline void RingBuffer<T, N, waitable, padding>::advanceTail(const std::size_t n) noexcept {
     tailCounter_.fetch_add(n, std::memory_order_release);
+    if constexpr (waitable) { tailCounter_.notify_one(); }
 };
 
-template <typename T, std::size_t N>
-inline void RingBuffer<T, N>::advanceHead(const std::size_t n) noexcept {
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline void RingBuffer<T, N, waitable, padding>::advanceHead(const std::size_t n) noexcept {
     headCounter_.fetch_add(n, std::memory_order_release);
+    if constexpr (waitable) { headCounter_.notify_one(); }
 };
 
+/**
+ * @brief Checks whether numElements many elements fit into the RingBuffer behind head. Only to be called by
+ * the producer.
+ *
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline bool RingBuffer<T, N, waitable, padding>::hasSpace(const std::size_t head,
+                                                          const std::size_t numElements) noexcept {
+    bool enoughSpace;
+    if constexpr ((sizeof(std::size_t) >= 8) && (N <= ((std::numeric_limits<std::size_t>::max() / 2) + 1U))) {
+        const std::size_t diff = head - N + numElements;
+        enoughSpace = (cachedTailCounter_ >= diff)
+                      || ((cachedTailCounter_ = tailCounter_.load(std::memory_order_acquire)) >= diff);
+    } else {
+        const std::size_t diff = N - numElements;
+        enoughSpace
+            = ((head - cachedTailCounter_ <= diff)
+               || ((head - (cachedTailCounter_ = tailCounter_.load(std::memory_order_acquire))) <= diff));
+    }
+    return enoughSpace;
+}
+
 /**
  * @brief The number of elements the Ringbuffer can maximally hold.
  *
  */
-template <typename T, std::size_t N>
-inline constexpr std::size_t RingBuffer<T, N>::capacity() const noexcept {
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline constexpr std::size_t RingBuffer<T, N, waitable, padding>::capacity() const noexcept {
     return N;
 };
 
@@ -128,8 +221,8 @@ inline constexpr std::size_t RingBuffer<T, N>::capacity() const noexcept {
  * is better (more performant) to just use pop and check if it succeeded.
  *
  */
-template <typename T, std::size_t N>
-inline bool RingBuffer<T, N>::empty() const noexcept {
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline bool RingBuffer<T, N, waitable, padding>::empty() const noexcept {
     return tailCounter_.load(std::memory_order_relaxed) == headCounter_.load(std::memory_order_acquire);
 };
 
@@ -138,8 +231,8 @@ inline bool RingBuffer<T, N>::empty() const noexcept {
  * is better (more performant) to just use push and check if it succeeded.
  *
  */
-template <typename T, std::size_t N>
-inline bool RingBuffer<T, N>::full() const noexcept {
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline bool RingBuffer<T, N, waitable, padding>::full() const noexcept {
     return tailCounter_.load(std::memory_order_acquire) + N == headCounter_.load(std::memory_order_relaxed);
 };
 
@@ -148,18 +241,18 @@ inline bool RingBuffer<T, N>::full() const noexcept {
  * to/pop from the Ringbuffer it is better (more performant) to just use push/pop and check if it succeeded.
  *
  */
-template <typename T, std::size_t N>
-inline std::size_t RingBuffer<T, N>::occupancy() const noexcept {
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline std::size_t RingBuffer<T, N, waitable, padding>::occupancy() const noexcept {
     return headCounter_.load(std::memory_order_acquire) - tailCounter_.load(std::memory_order_acquire);
 };
 
-template <typename T, std::size_t N>
-inline std::optional<T> RingBuffer<T, N>::pop() noexcept {
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline std::optional<T> RingBuffer<T, N, waitable, padding>::pop() noexcept {
     const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
     if ((cachedHeadCounter_ != tail)
         || ((cachedHeadCounter_ = headCounter_.load(std::memory_order_acquire)) != tail)) {
-        const std::size_t pos = tail % N;
-        std::optional<T> val(data_[pos]);
+        const std::size_t pos = index(tail);
+        std::optional<T> val(std::move(data_[pos]));
         advanceTail();
         return val;
     } else {
@@ -167,53 +260,110 @@ inline std::optional<T> RingBuffer<T, N>::pop() noexcept {
     }
 }
 
-template <typename T, std::size_t N>
-inline bool RingBuffer<T, N>::pop(T &out) noexcept {
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline bool RingBuffer<T, N, waitable, padding>::pop(T &out) noexcept {
     const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
     const bool hasData = (cachedHeadCounter_ != tail)
                          || ((cachedHeadCounter_ = headCounter_.load(std::memory_order_acquire)) != tail);
     if (hasData) {
-        const std::size_t pos = tail % N;
-        out = data_[pos];
+        const std::size_t pos = index(tail);
+        out = std::move(data_[pos]);
         advanceTail();
     }
     return hasData;
 }
 
-template <typename T, std::size_t N>
-inline bool RingBuffer<T, N>::push(const T value) noexcept {
+/**
+ * @brief Batch pop. Claims all available elements, up to maxCount, with a single load of the head and a single
+ * release of the tail. The elements are moved in order to out.
+ *
+ * @param out Beginning of the destination range.
+ * @param maxCount Maximum number of elements to be popped.
+ * @return std::size_t Number of elements popped.
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+template <class OutputIt>
+inline std::size_t RingBuffer<T, N, waitable, padding>::pop(OutputIt out,
+                                                            const std::size_t maxCount) noexcept {
+    const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
+    if (cachedHeadCounter_ - tail < maxCount) {
+        cachedHeadCounter_ = headCounter_.load(std::memory_order_acquire);
+    }
+    const std::size_t numElements = std::min(cachedHeadCounter_ - tail, maxCount);
+
+    if (numElements > 0U) {
+        const std::size_t tailIndx = index(tail);
+
+        const std::size_t numElementsFirstPop = std::min(N - tailIndx, numElements);
+        const std::size_t numElementsSecondPop = numElements - numElementsFirstPop;
+
+        auto dataIt = data_.begin();
+        std::advance(dataIt, tailIndx);
+        out = std::copy_n(std::make_move_iterator(dataIt), numElementsFirstPop, out);
+        std::copy_n(std::make_move_iterator(data_.begin()), numElementsSecondPop, out);
+
+        advanceTail(numElements);
+    }
+    return numElements;
+}
+
+/**
+ * @brief Pops all elements currently in the RingBuffer.
+ *
+ * @param out Beginning of the destination range.
+ * @return std::size_t Number of elements popped.
+ *
+ * @see pop
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+template <class OutputIt>
+inline std::size_t RingBuffer<T, N, waitable, padding>::drain(OutputIt out) noexcept {
+    return pop(out, N);
+}
+
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+template <typename U>
+inline bool RingBuffer<T, N, waitable, padding>::pushValue(U &&value) noexcept {
     const std::size_t head = headCounter_.load(std::memory_order_relaxed);
     const std::size_t headLoopAround = head - N;
     const bool nonFull
         = (cachedTailCounter_ != headLoopAround)
           || ((cachedTailCounter_ = tailCounter_.load(std::memory_order_acquire)) != headLoopAround);
     if (nonFull) {
-        data_[head % N] = value;
+        data_[index(head)] = std::forward<U>(value);
         advanceHead();
     }
     return nonFull;
 }
 
-template <typename T, std::size_t N>
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline bool RingBuffer<T, N, waitable, padding>::push(const T &value) noexcept {
+    return pushValue(value);
+}
+
+/**
+ * @brief Moves value into the RingBuffer. The value is left untouched if the push fails.
+ *
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline bool RingBuffer<T, N, waitable, padding>::push(T &&value) noexcept {
+    return pushValue(std::move(value));
+}
+
+/**
+ * @brief Batch push. Either all elements in [first, last) are pushed or none. Pass std::move_iterator to move
+ * the elements into the RingBuffer.
+ *
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
 template <class InputIt>
-inline bool RingBuffer<T, N>::push(InputIt first, InputIt last) noexcept {
+inline bool RingBuffer<T, N, waitable, padding>::push(InputIt first, InputIt last) noexcept {
     const std::size_t numElements = static_cast<std::size_t>(std::distance(first, last));
-    std::size_t head = headCounter_.load(std::memory_order_relaxed);
-
-    bool enoughSpace;
-    if constexpr ((sizeof(std::size_t) >= 8) && (N <= ((std::numeric_limits<std::size_t>::max() / 2) + 1U))) {
-        const std::size_t diff = head - N + numElements;
-        enoughSpace = (cachedTailCounter_ >= diff)
-                      || ((cachedTailCounter_ = tailCounter_.load(std::memory_order_acquire)) >= diff);
-    } else {
-        const std::size_t diff = N - numElements;
-        enoughSpace
-            = ((head - cachedTailCounter_ <= diff)
-               || ((head - (cachedTailCounter_ = tailCounter_.load(std::memory_order_acquire))) <= diff));
-    }
+    const std::size_t head = headCounter_.load(std::memory_order_relaxed);
 
+    const bool enoughSpace = hasSpace(head, numElements);
     if (enoughSpace) {
-        const std::size_t headIndx = head % N;
+        const std::size_t headIndx = index(head);
 
         const std::size_t numElementsFirstPush = std::min(N - headIndx, numElements);
         const std::size_t numElementsSecondPush = numElements - numElementsFirstPush;
@@ -230,4 +380,193 @@ inline bool RingBuffer<T, N>::push(InputIt first, InputIt last) noexcept {
     return enoughSpace;
 }
 
+/**
+ * @brief Batch push with non-temporal stores, such that the slots are not pulled into the cache of the
+ * producer only to be stolen back by the consumer. Streaming is used only if the batch covers at least
+ * streamingMinBytes_ and T and the iterators allow it, otherwise this is the regular batch push.
+ *
+ * @see push
+ * @see streamCopy
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+template <class InputIt>
+inline bool RingBuffer<T, N, waitable, padding>::pushStreaming(InputIt first, InputIt last) noexcept {
+    if constexpr (std::contiguous_iterator<InputIt> && hasStreamingCopy<T>()) {
+        const std::size_t numElements = static_cast<std::size_t>(std::distance(first, last));
+        if (numElements * sizeof(T) < streamingMinBytes_) { return push(first, last); }
+
+        const std::size_t head = headCounter_.load(std::memory_order_relaxed);
+
+        const bool enoughSpace = hasSpace(head, numElements);
+        if (enoughSpace) {
+            const std::size_t headIndx = index(head);
+
+            const std::size_t numElementsFirstPush = std::min(N - headIndx, numElements);
+            const std::size_t numElementsSecondPush = numElements - numElementsFirstPush;
+
+            const T *src = std::to_address(first);
+            streamCopy(src, numElementsFirstPush, data_.data() + headIndx);
+            streamCopy(src + numElementsFirstPush, numElementsSecondPush, data_.data());
+            streamFence();
+
+            advanceHead(numElements);
+        }
+        return enoughSpace;
+    } else {
+        return push(first, last);
+    }
+}
+
+/**
+ * @brief Reserves n consecutive slots at the head of the RingBuffer for the producer to write into directly.
+ * The reserved slots are handed out as (at most) two spans, the second of which is only non-empty if the
+ * reservation wraps around the end of the buffer. The elements become visible to the consumer only once they
+ * are committed.
+ *
+ * @param n Number of slots to be reserved.
+ * @return std::array<std::span<T>, 2U> The reserved slots in order. Both spans are empty if the reservation
+ * failed because there is not enough space.
+ *
+ * @see commit
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline std::array<std::span<T>, 2U> RingBuffer<T, N, waitable, padding>::reserve(
+    const std::size_t n) noexcept {
+    const std::size_t head = headCounter_.load(std::memory_order_relaxed);
+
+    std::array<std::span<T>, 2U> reservation;
+    if (hasSpace(head, n)) {
+        const std::size_t headIndx = index(head);
+
+        const std::size_t numElementsFirstSpan = std::min(N - headIndx, n);
+        const std::size_t numElementsSecondSpan = n - numElementsFirstSpan;
+
+        reservation[0U] = std::span<T>(data_).subspan(headIndx, numElementsFirstSpan);
+        reservation[1U] = std::span<T>(data_).first(numElementsSecondSpan);
+    }
+    return reservation;
+}
+
+/**
+ * @brief Publishes the first n slots of the previous reservation to the consumer.
+ *
+ * @param n Number of slots to be committed. Must not exceed the size of the previous reservation.
+ *
+ * @see reserve
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline void RingBuffer<T, N, waitable, padding>::commit(const std::size_t n) noexcept {
+    advanceHead(n);
+}
+
+/**
+ * @brief Blocking push. Retries the push a few times and then sleeps on the tail until the consumer has freed
+ * a slot, such that a backed up producer does not keep a core busy.
+ *
+ * @see push
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline void RingBuffer<T, N, waitable, padding>::pushWait(const T &value) noexcept
+    requires waitable
+{
+    pushWait(T(value));
+}
+
+/**
+ * @brief Blocking push. Moves value into the RingBuffer once there is space.
+ *
+ * @see pushWait
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline void RingBuffer<T, N, waitable, padding>::pushWait(T &&value) noexcept
+    requires waitable
+{
+    for (std::size_t attempt = 1U; not push(std::move(value)); ++attempt) {
+        if (attempt < spinsBeforeWait_) { continue; }
+
+        const std::size_t fullTail = headCounter_.load(std::memory_order_relaxed) - N;
+        tailCounter_.wait(fullTail, std::memory_order_acquire);
+    }
+}
+
+/**
+ * @brief Blocking batch push. Pushes the elements in [first, last) in chunks of at most the capacity, each of
+ * which is pushed at once as soon as there is space for all of its elements.
+ *
+ * @param first Beginning of the range.
+ * @param last End of the range.
+ *
+ * @see pushWait
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+template <class InputIt>
+inline void RingBuffer<T, N, waitable, padding>::pushWait(InputIt first, InputIt last) noexcept
+    requires waitable
+{
+    std::size_t remaining = static_cast<std::size_t>(std::distance(first, last));
+    while (remaining > 0U) {
+        const std::size_t numElements = std::min(remaining, N);
+        const InputIt chunkLast = std::next(first, static_cast<std::ptrdiff_t>(numElements));
+
+        for (std::size_t attempt = 1U; not push(first, chunkLast); ++attempt) {
+            if (attempt < spinsBeforeWait_) { continue; }
+
+            const std::size_t head = headCounter_.load(std::memory_order_relaxed);
+            const std::size_t tail = tailCounter_.load(std::memory_order_acquire);
+            if (head - tail > N - numElements) { tailCounter_.wait(tail, std::memory_order_acquire); }
+        }
+
+        first = chunkLast;
+        remaining -= numElements;
+    }
+}
+
+/**
+ * @brief Blocking pop. Retries the pop a few times and then sleeps on the head until the producer has pushed
+ * an element.
+ *
+ * @see pop
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+inline T RingBuffer<T, N, waitable, padding>::popWait() noexcept
+    requires waitable
+{
+    T val;
+    popWait(&val, 1U);
+    return val;
+}
+
+/**
+ * @brief Blocking batch pop. Waits until at least one element is available and then pops all available
+ * elements, up to maxCount.
+ *
+ * @param out Beginning of the destination range.
+ * @param maxCount Maximum number of elements to be popped. Must be positive.
+ * @return std::size_t Number of elements popped.
+ *
+ * @see popWait
+ */
+template <typename T, std::size_t N, bool waitable, std::size_t padding>
+template <class OutputIt>
+inline std::size_t RingBuffer<T, N, waitable, padding>::popWait(OutputIt out,
+                                                                 const std::size_t maxCount) noexcept
+    requires waitable
+{
+    std::size_t numElements = 0U;
+    for (std::size_t attempt = 1U; (numElements = pop(out, maxCount)) == 0U; ++attempt) {
+        if (attempt < spinsBeforeWait_) { continue; }
+
+        const std::size_t emptyHead = tailCounter_.load(std::memory_order_relaxed);
+        headCounter_.wait(emptyHead, std::memory_order_acquire);
+    }
+    return numElements;
+}
+
+/**
+ * @brief A RingBuffer whose producer and consumer may block in pushWait and popWait.
+ *
+ */
+template <typename T, std::size_t N>
+using WaitableRingBuffer = RingBuffer<T, N, true>;
+
 }        // end namespace spapq
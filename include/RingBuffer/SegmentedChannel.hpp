@@ -0,0 +1,359 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "Configuration/config.hpp"
+
+namespace spapq {
+
+/**
+ * @brief An unbounded single-producer single-consumer first-in-first-out queue made of linked fixed-size
+ * segments. The segments form a chain from the oldest consumed segment to the segment currently written to.
+ * Segments the consumer has moved past are recycled by the producer before any new segment is allocated, such
+ * that the memory is bounded by the largest backlog rather than the total number of pushes.
+ *
+ * @tparam T Data type.
+ * @tparam S Number of elements per segment.
+ * @tparam padding Alignment of the embedded segment, the consumer fields and the producer fields.
+ *
+ * @see RingBuffer
+ */
+template <typename T, std::size_t S, std::size_t padding = CACHE_LINE_SIZE>
+class alignas(padding) SegmentedChannel {
+  private:
+    /**
+     * @brief A segment of the channel. The pointer to the next segment is only written by the producer and is
+     * only read by the consumer after the producer has published an element beyond this segment.
+     *
+     */
+    struct Segment {
+        std::array<T, S> data_;
+        Segment *next_{nullptr};
+    };
+
+    alignas(padding) Segment firstSegment_;        ///< Segment embedded in the channel, never freed.
+
+    // consumer
+    alignas(padding) std::atomic<std::size_t> tailCounter_{0U};
+    std::atomic<Segment *> readSegment_{&firstSegment_};        ///< Segment being read. Loaded by the producer
+                                                                ///< to find recyclable segments.
+    std::size_t readIndex_{0U};                                 ///< Next position in readSegment_.
+    std::size_t cachedHeadCounter_{0U};
+
+    // producer
+    alignas(padding) std::atomic<std::size_t> headCounter_{0U};
+    Segment *writeSegment_{&firstSegment_};         ///< Segment being written.
+    std::size_t writeIndex_{0U};                    ///< Next position in writeSegment_.
+    Segment *oldestSegment_{&firstSegment_};        ///< Start of the chain, recycled once consumed.
+    std::size_t numSegments_{1U};                   ///< Number of segments in the chain.
+
+    inline Segment *acquireSegment() noexcept;
+    [[nodiscard("Allocation of segments may fail.\n")]] inline bool ensureSpace(const std::size_t n) noexcept;
+
+    template <typename U>
+    inline void write(U &&value) noexcept;
+    inline T &readSlot() noexcept;
+
+    template <typename U>
+    inline bool pushValue(U &&value) noexcept;
+
+  public:
+    SegmentedChannel() = default;
+    SegmentedChannel(const SegmentedChannel &other) = delete;
+    SegmentedChannel(SegmentedChannel &&other) = delete;
+    SegmentedChannel &operator=(const SegmentedChannel &other) = delete;
+    SegmentedChannel &operator=(SegmentedChannel &&other) = delete;
+    ~SegmentedChannel() noexcept;
+
+    inline constexpr std::size_t capacity() const noexcept;
+    inline constexpr std::size_t segmentSize() const noexcept;
+    inline std::size_t numSegments() const noexcept;
+
+    inline bool empty() const noexcept;
+    inline bool full() const noexcept;
+    inline std::size_t occupancy() const noexcept;
+
+    inline std::optional<T> pop() noexcept;
+    [[nodiscard("Pop may fail when queue is empty.\n")]] inline bool pop(T &out) noexcept;
+    template <class OutputIt>
+    inline std::size_t pop(OutputIt out, const std::size_t maxCount) noexcept;
+    template <class OutputIt>
+    inline std::size_t drain(OutputIt out) noexcept;
+    [[nodiscard("Push may fail when memory is exhausted.\n")]] inline bool push(const T &value) noexcept;
+    [[nodiscard("Push may fail when memory is exhausted.\n")]] inline bool push(T &&value) noexcept;
+    template <class InputIt>
+    [[nodiscard("Push may fail when memory is exhausted.\n")]] inline bool push(InputIt first,
+                                                                                InputIt last) noexcept;
+
+    // assertions
+    static_assert(std::has_single_bit(padding) && padding >= alignof(std::atomic<std::size_t>)
+                      && padding >= alignof(T),
+                  "Padding needs to be a power of two and at least the alignment of the counters and T!\n");
+    static_assert(S > 0U, "No trivial segments allowed!\n");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free, "Want atomic to be lock free.\n");
+    static_assert(std::atomic<Segment *>::is_always_lock_free, "Want atomic to be lock free.\n");
+    static_assert(std::is_nothrow_default_constructible_v<T>);
+    static_assert(std::is_nothrow_move_constructible_v<T>);
+    static_assert(std::is_nothrow_move_assignable_v<T>);
+};
+
+// Implementation details
+
+template <typename T, std::size_t S, std::size_t padding>
+SegmentedChannel<T, S, padding>::~SegmentedChannel() noexcept {
+    Segment *segment = oldestSegment_;
+    while (segment != nullptr) {
+        Segment *next = segment->next_;
+        if (segment != &firstSegment_) { delete segment; }
+        segment = next;
+    }
+}
+
+/**
+ * @brief Returns a fresh segment, recycling the oldest segment if the consumer has moved past it and
+ * allocating a new one otherwise. Only to be called by the producer.
+ *
+ * @return Segment* The segment or nullptr if the allocation failed.
+ */
+template <typename T, std::size_t S, std::size_t padding>
+inline SegmentedChannel<T, S, padding>::Segment *SegmentedChannel<T, S, padding>::acquireSegment() noexcept {
+    Segment *segment = nullptr;
+    if (oldestSegment_ != readSegment_.load(std::memory_order_acquire)) {
+        segment = oldestSegment_;
+        oldestSegment_ = segment->next_;
+        segment->next_ = nullptr;
+    } else {
+        segment = new (std::nothrow) Segment;
+        if (segment != nullptr) { ++numSegments_; }
+    }
+    return segment;
+}
+
+/**
+ * @brief Makes sure the chain from the current write position on has room for n more elements.
+ *
+ */
+template <typename T, std::size_t S, std::size_t padding>
+inline bool SegmentedChannel<T, S, padding>::ensureSpace(const std::size_t n) noexcept {
+    std::size_t room = S - writeIndex_;
+    if (room >= n) { return true; }
+
+    Segment *last = writeSegment_;
+    while (last->next_ != nullptr) {
+        last = last->next_;
+        room += S;
+    }
+
+    while (room < n) {
+        Segment *segment = acquireSegment();
+        if (segment == nullptr) { return false; }
+
+        last->next_ = segment;
+        last = segment;
+        room += S;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes value at the write position, moving on to the next segment if necessary. Space needs to have
+ * been ensured.
+ *
+ */
+template <typename T, std::size_t S, std::size_t padding>
+template <typename U>
+inline void SegmentedChannel<T, S, padding>::write(U &&value) noexcept {
+    if (writeIndex_ == S) {
+        writeSegment_ = writeSegment_->next_;
+        writeIndex_ = 0U;
+    }
+    writeSegment_->data_[writeIndex_++] = std::forward<U>(value);
+}
+
+/**
+ * @brief Returns the slot at the read position, moving on to the next segment if necessary. Only to be called
+ * if an element is available.
+ *
+ */
+template <typename T, std::size_t S, std::size_t padding>
+inline T &SegmentedChannel<T, S, padding>::readSlot() noexcept {
+    Segment *segment = readSegment_.load(std::memory_order_relaxed);
+    if (readIndex_ == S) {
+        segment = segment->next_;
+        readSegment_.store(segment, std::memory_order_release);
+        readIndex_ = 0U;
+    }
+    return segment->data_[readIndex_++];
+}
+
+/**
+ * @brief The channel is unbounded.
+ *
+ */
+template <typename T, std::size_t S, std::size_t padding>
+inline constexpr std::size_t SegmentedChannel<T, S, padding>::capacity() const noexcept {
+    return std::numeric_limits<std::size_t>::max();
+}
+
+/**
+ * @brief The number of elements per segment.
+ *
+ */
+template <typename T, std::size_t S, std::size_t padding>
+inline constexpr std::size_t SegmentedChannel<T, S, padding>::segmentSize() const noexcept {
+    return S;
+}
+
+/**
+ * @brief The number of segments, including recycled ones, held by the channel. Only to be called by the
+ * producer.
+ *
+ */
+template <typename T, std::size_t S, std::size_t padding>
+inline std::size_t SegmentedChannel<T, S, padding>::numSegments() const noexcept {
+    return numSegments_;
+}
+
+template <typename T, std::size_t S, std::size_t padding>
+inline bool SegmentedChannel<T, S, padding>::empty() const noexcept {
+    return tailCounter_.load(std::memory_order_relaxed) == headCounter_.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief The channel is never full. Pushes may only fail when memory is exhausted.
+ *
+ */
+template <typename T, std::size_t S, std::size_t padding>
+inline bool SegmentedChannel<T, S, padding>::full() const noexcept {
+    return false;
+}
+
+template <typename T, std::size_t S, std::size_t padding>
+inline std::size_t SegmentedChannel<T, S, padding>::occupancy() const noexcept {
+    return headCounter_.load(std::memory_order_acquire) - tailCounter_.load(std::memory_order_acquire);
+}
+
+template <typename T, std::size_t S, std::size_t padding>
+inline std::optional<T> SegmentedChannel<T, S, padding>::pop() noexcept {
+    std::optional<T> val(std::nullopt);
+    pop(&val, 1U);
+    return val;
+}
+
+template <typename T, std::size_t S, std::size_t padding>
+inline bool SegmentedChannel<T, S, padding>::pop(T &out) noexcept {
+    return pop(&out, 1U) == 1U;
+}
+
+/**
+ * @brief Batch pop. Moves all available elements, up to maxCount, in order to out with a single load of the
+ * head and a single release of the tail.
+ *
+ * @param out Beginning of the destination range.
+ * @param maxCount Maximum number of elements to be popped.
+ * @return std::size_t Number of elements popped.
+ */
+template <typename T, std::size_t S, std::size_t padding>
+template <class OutputIt>
+inline std::size_t SegmentedChannel<T, S, padding>::pop(OutputIt out, const std::size_t maxCount) noexcept {
+    const std::size_t tail = tailCounter_.load(std::memory_order_relaxed);
+    if (cachedHeadCounter_ - tail < maxCount) {
+        cachedHeadCounter_ = headCounter_.load(std::memory_order_acquire);
+    }
+    const std::size_t numElements = std::min(cachedHeadCounter_ - tail, maxCount);
+
+    for (std::size_t i = 0U; i < numElements; ++i) {
+        *out = std::move(readSlot());
+        ++out;
+    }
+
+    if (numElements > 0U) { tailCounter_.store(tail + numElements, std::memory_order_release); }
+    return numElements;
+}
+
+/**
+ * @brief Pops all elements currently in the channel.
+ *
+ * @param out Beginning of the destination range.
+ * @return std::size_t Number of elements popped.
+ *
+ * @see pop
+ */
+template <typename T, std::size_t S, std::size_t padding>
+template <class OutputIt>
+inline std::size_t SegmentedChannel<T, S, padding>::drain(OutputIt out) noexcept {
+    return pop(out, std::numeric_limits<std::size_t>::max());
+}
+
+template <typename T, std::size_t S, std::size_t padding>
+template <typename U>
+inline bool SegmentedChannel<T, S, padding>::pushValue(U &&value) noexcept {
+    const bool success = ensureSpace(1U);
+    if (success) {
+        write(std::forward<U>(value));
+        headCounter_.store(headCounter_.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+    }
+    return success;
+}
+
+template <typename T, std::size_t S, std::size_t padding>
+inline bool SegmentedChannel<T, S, padding>::push(const T &value) noexcept {
+    return pushValue(value);
+}
+
+/**
+ * @brief Moves value into the channel. The value is left untouched if the push fails.
+ *
+ */
+template <typename T, std::size_t S, std::size_t padding>
+inline bool SegmentedChannel<T, S, padding>::push(T &&value) noexcept {
+    return pushValue(std::move(value));
+}
+
+/**
+ * @brief Batch push. Either all elements in [first, last) are pushed or none. Pass std::move_iterator to move
+ * the elements into the channel.
+ *
+ */
+template <typename T, std::size_t S, std::size_t padding>
+template <class InputIt>
+inline bool SegmentedChannel<T, S, padding>::push(InputIt first, InputIt last) noexcept {
+    const std::size_t numElements = static_cast<std::size_t>(std::distance(first, last));
+
+    const bool success = ensureSpace(numElements);
+    if (success) {
+        for (; first != last; ++first) { write(*first); }
+        headCounter_.store(headCounter_.load(std::memory_order_relaxed) + numElements,
+                           std::memory_order_release);
+    }
+    return success;
+}
+
+}        // end namespace spapq
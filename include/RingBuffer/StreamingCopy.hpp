@@ -0,0 +1,95 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace spapq {
+
+/**
+ * @brief Whether streamCopy bypasses the cache for type T on this target.
+ *
+ */
+template <typename T>
+inline constexpr bool hasStreamingCopy() noexcept {
+#if defined(__SSE2__)
+    return std::is_trivially_copyable_v<T>;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Copies n elements from src to dst using non-temporal (streaming) stores where available, such that
+ * the destination cache lines are not pulled into the cache of the writing core. Only the (at most two)
+ * partial 16 byte chunks at either end of the destination are written with regular stores. Falls back to
+ * std::copy_n if streaming stores are not available for T. The stores are weakly ordered and need to be
+ * followed by streamFence before the data is published to another thread.
+ *
+ * @see streamFence
+ */
+template <typename T>
+inline void streamCopy(const T *src, const std::size_t n, T *dst) noexcept {
+    if constexpr (hasStreamingCopy<T>()) {
+#if defined(__SSE2__)
+        constexpr std::size_t chunk = sizeof(__m128i);
+
+        const char *srcBytes = reinterpret_cast<const char *>(src);
+        char *dstBytes = reinterpret_cast<char *>(dst);
+        std::size_t numBytes = n * sizeof(T);
+
+        const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(dstBytes) % chunk;
+        const std::size_t headBytes = std::min(misalignment == 0U ? 0U : chunk - misalignment, numBytes);
+        std::memcpy(dstBytes, srcBytes, headBytes);
+        srcBytes += headBytes;
+        dstBytes += headBytes;
+        numBytes -= headBytes;
+
+        for (; numBytes >= chunk; numBytes -= chunk, srcBytes += chunk, dstBytes += chunk) {
+            _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes),
+                             _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes)));
+        }
+
+        std::memcpy(dstBytes, srcBytes, numBytes);
+#endif
+    } else {
+        std::copy_n(src, n, dst);
+    }
+}
+
+/**
+ * @brief Orders all preceding streaming stores before any subsequent store.
+ *
+ * @see streamCopy
+ */
+inline void streamFence() noexcept {
+#if defined(__SSE2__)
+    _mm_sfence();
+#endif
+}
+
+}        // end namespace spapq
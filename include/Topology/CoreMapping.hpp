@@ -0,0 +1,201 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ParallelPriotityQueue/QNetwork.hpp"
+#include "Topology/CpuTopology.hpp"
+
+namespace spapq {
+
+/**
+ * @brief Marks a worker which is not pinned to any CPU.
+ *
+ */
+inline constexpr std::size_t UNPINNED_CORE = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Reads the effective cpuset of the cgroup of the process, trying the cgroup v2 and the cgroup v1
+ * layout.
+ *
+ * @param cgroupRoot Mount point of the cgroup file system.
+ * @return std::optional<std::vector<std::size_t>> Sorted CPUs or std::nullopt if no cpuset could be read.
+ */
+inline std::optional<std::vector<std::size_t>> cgroupCpus(
+    const std::filesystem::path &cgroupRoot = "/sys/fs/cgroup") {
+    for (const std::filesystem::path &file :
+         {cgroupRoot / "cpuset.cpus.effective", cgroupRoot / "cpuset" / "cpuset.effective_cpus"}) {
+        std::ifstream stream(file);
+        if (not stream) { continue; }
+
+        std::string list;
+        std::getline(stream, list);
+        std::optional<std::vector<std::size_t>> cpus = parseCpuList(list);
+        if (cpus.has_value() && (not cpus->empty())) { return cpus; }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief The CPUs the calling thread may run on, as restricted by its affinity mask and the cpuset of its
+ * cgroup. Falls back to the cgroup cpuset should sched_getaffinity fail.
+ *
+ * @return std::vector<std::size_t> Sorted CPUs. Empty if neither could be determined.
+ */
+inline std::vector<std::size_t> allowedCpus() {
+    std::vector<std::size_t> cpus;
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuset) == 0) {
+        for (std::size_t cpu = 0U; cpu < static_cast<std::size_t>(CPU_SETSIZE); ++cpu) {
+            if (CPU_ISSET(cpu, &cpuset)) { cpus.push_back(cpu); }
+        }
+    }
+    if (cpus.empty()) { cpus = cgroupCpus().value_or(std::vector<std::size_t>()); }
+
+    return cpus;
+}
+
+/**
+ * @brief Computes the CPU each worker is pinned to.
+ *
+ * With CorePinning::Remap, the logical cores are kept if they are all allowed. Otherwise, the distinct
+ * logical cores are mapped in increasing order onto the allowed CPUs, such that workers on nearby logical
+ * cores stay on nearby CPUs. Should there be more distinct logical cores than allowed CPUs, consecutive
+ * logical cores share a CPU.
+ *
+ * @param logicalCores Logical core of each worker, see QNetwork::logicalCore_.
+ * @param allowed Sorted CPUs the workers may be pinned to, e.g., allowedCpus().
+ * @param pinning Pinning mode of the network.
+ * @return std::vector<std::size_t> CPU of each worker or UNPINNED_CORE.
+ */
+inline std::vector<std::size_t> mapLogicalCores(const std::vector<std::size_t> &logicalCores,
+                                                const std::vector<std::size_t> &allowed,
+                                                const CorePinning pinning) {
+    switch (pinning) {
+        case CorePinning::Strict: return logicalCores;
+        case CorePinning::Unpinned: return std::vector<std::size_t>(logicalCores.size(), UNPINNED_CORE);
+        case CorePinning::Remap: break;
+    }
+
+    if (allowed.empty()) { return std::vector<std::size_t>(logicalCores.size(), UNPINNED_CORE); }
+
+    if (std::all_of(logicalCores.cbegin(), logicalCores.cend(), [&allowed](const std::size_t core) {
+            return std::binary_search(allowed.cbegin(), allowed.cend(), core);
+        })) {
+        return logicalCores;
+    }
+
+    std::vector<std::size_t> distinctCores = logicalCores;
+    std::sort(distinctCores.begin(), distinctCores.end());
+    distinctCores.erase(std::unique(distinctCores.begin(), distinctCores.end()), distinctCores.end());
+
+    std::vector<std::size_t> mapping(logicalCores.size());
+    for (std::size_t worker = 0U; worker < logicalCores.size(); ++worker) {
+        const auto it = std::lower_bound(distinctCores.cbegin(), distinctCores.cend(), logicalCores[worker]);
+        const std::size_t rank = static_cast<std::size_t>(std::distance(distinctCores.cbegin(), it));
+        if (distinctCores.size() <= allowed.size()) {
+            mapping[worker] = allowed[rank];
+        } else {
+            mapping[worker] = allowed[(rank * allowed.size()) / distinctCores.size()];
+        }
+    }
+    return mapping;
+}
+
+/**
+ * @brief Pins the calling thread to a single CPU.
+ *
+ * @return int Zero on success, otherwise the error returned by pthread_setaffinity_np.
+ */
+inline int pinThisThread(const std::size_t cpu) {
+    if (cpu >= static_cast<std::size_t>(CPU_SETSIZE)) { return EINVAL; }
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+}
+
+/**
+ * @brief Pins the calling worker thread to its CPU. Should this fail, the program is terminated with
+ * CorePinning::Strict, whereas otherwise the worker continues unpinned and its CPU is set to UNPINNED_CORE.
+ *
+ * @param workerId Number of the worker, only used for the error message.
+ * @param cpu CPU of the worker as computed by mapLogicalCores.
+ * @param pinning Pinning mode of the network.
+ */
+inline void pinWorkerThread(const std::size_t workerId, std::size_t &cpu, const CorePinning pinning) {
+    if (cpu == UNPINNED_CORE) { return; }
+
+    const int rc = pinThisThread(cpu);
+    if (rc != 0) {
+        const std::string errorMessage = "Call to pthread_setaffinity_np returned error "
+                                         + std::to_string(rc)
+                                         + ".\nFailed to pin worker number "
+                                         + std::to_string(workerId)
+                                         + "'s thread to logical core "
+                                         + std::to_string(cpu)
+                                         + ".\n";
+        if (pinning == CorePinning::Strict) {
+            std::cerr << errorMessage;
+            std::exit(EXIT_FAILURE);
+        }
+        std::cerr << errorMessage + "The worker continues unpinned.\n";
+        cpu = UNPINNED_CORE;
+    }
+}
+
+/**
+ * @brief Prints the CPU each worker has been pinned to next to its logical core.
+ *
+ */
+inline void printCoreMapping(const std::vector<std::size_t> &logicalCores,
+                             const std::vector<std::size_t> &workerCores) {
+    const std::string singleIndent = " ";
+
+    std::cerr << "CoreMapping:\n";
+    for (std::size_t worker = 0U; worker < workerCores.size(); ++worker) {
+        std::cerr << singleIndent << "Worker " << worker << ": logical core " << logicalCores[worker]
+                  << " -> ";
+        if (workerCores[worker] == UNPINNED_CORE) {
+            std::cerr << "unpinned\n";
+        } else {
+            std::cerr << "CPU " << workerCores[worker] << "\n";
+        }
+    }
+}
+
+}        // end namespace spapq
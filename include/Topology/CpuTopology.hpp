@@ -0,0 +1,298 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+namespace spapq {
+
+/**
+ * @brief Location of a logical CPU, i.e., a hardware thread, in the machine hierarchy.
+ *
+ */
+struct LogicalCpu {
+    std::size_t cpu_;             ///< Logical CPU number as used by the scheduler and pthread_setaffinity_np.
+    std::size_t node_;            ///< NUMA node.
+    std::size_t package_;         ///< Physical package or socket.
+    std::size_t core_;            ///< Physical core, only unique within its package. Hardware threads of the
+                                  ///< same core are SMT siblings, sharing its L1 and L2 caches.
+
+    constexpr bool operator==(const LogicalCpu &other) const = default;
+};
+
+/**
+ * @brief Parses a Linux cpu list, e.g. "0-3,8,10-11", as found in sysfs and in cgroup cpusets.
+ *
+ * @return std::optional<std::vector<std::size_t>> Sorted CPU numbers without duplicates or std::nullopt if
+ * the list is malformed.
+ */
+inline std::optional<std::vector<std::size_t>> parseCpuList(const std::string &list) {
+    std::vector<std::size_t> cpus;
+
+    std::size_t pos = 0U;
+    const std::size_t end = list.find_last_not_of(" \n\t\r") + 1U;
+    if (end == 0U) { return cpus; }
+
+    auto readNumber = [&list, &pos, end](std::size_t &number) {
+        const auto [ptr, ec] = std::from_chars(list.data() + pos, list.data() + end, number);
+        if (ec != std::errc()) { return false; }
+        pos = static_cast<std::size_t>(ptr - list.data());
+        return true;
+    };
+
+    while (pos < end) {
+        std::size_t first = 0U;
+        if (not readNumber(first)) { return std::nullopt; }
+
+        std::size_t last = first;
+        if (pos < end && list[pos] == '-') {
+            ++pos;
+            if (not readNumber(last)) { return std::nullopt; }
+            if (last < first) { return std::nullopt; }
+        }
+
+        for (std::size_t cpu = first; cpu <= last; ++cpu) { cpus.push_back(cpu); }
+
+        if (pos < end) {
+            if (list[pos] != ',') { return std::nullopt; }
+            ++pos;
+            // a separator needs to be followed by another entry
+            if (pos == end) { return std::nullopt; }
+        }
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+/**
+ * @brief The hierarchy of NUMA nodes, packages, physical cores and hardware threads of the machine. The
+ * logical CPUs are kept sorted by node, package, core and CPU number, such that CPUs sharing caches or memory
+ * are adjacent.
+ *
+ */
+class CpuTopology {
+  private:
+    std::vector<LogicalCpu> cpus_;
+
+    static inline std::optional<std::string> readFile(const std::filesystem::path &file);
+    static inline std::optional<std::size_t> readNumber(const std::filesystem::path &file);
+
+  public:
+    CpuTopology() = default;
+    explicit CpuTopology(std::vector<LogicalCpu> cpus);
+
+    static inline CpuTopology fromSysfs(const std::filesystem::path &sysfsRoot = "/sys/devices/system");
+
+    inline const std::vector<LogicalCpu> &cpus() const noexcept { return cpus_; }
+
+    inline bool empty() const noexcept { return cpus_.empty(); }
+
+    inline std::size_t numCpus() const noexcept { return cpus_.size(); }
+
+    inline std::size_t numNodes() const;
+    inline std::size_t numPhysicalCores() const;
+
+    inline bool areSmtSiblings(const std::size_t cpuA, const std::size_t cpuB) const;
+    inline bool onSeparatePhysicalCores(const std::vector<std::size_t> &cpus) const;
+    inline CpuTopology physicalCoresOnly() const;
+
+    inline void print() const;
+};
+
+// Implementation details
+
+inline CpuTopology::CpuTopology(std::vector<LogicalCpu> cpus) : cpus_(std::move(cpus)) {
+    std::sort(cpus_.begin(), cpus_.end(), [](const LogicalCpu &a, const LogicalCpu &b) {
+        return std::tie(a.node_, a.package_, a.core_, a.cpu_)
+               < std::tie(b.node_, b.package_, b.core_, b.cpu_);
+    });
+}
+
+inline std::optional<std::string> CpuTopology::readFile(const std::filesystem::path &file) {
+    std::ifstream stream(file);
+    if (not stream) { return std::nullopt; }
+
+    std::string content;
+    std::getline(stream, content);
+    return content;
+}
+
+inline std::optional<std::size_t> CpuTopology::readNumber(const std::filesystem::path &file) {
+    const std::optional<std::string> content = readFile(file);
+    if (not content.has_value()) { return std::nullopt; }
+
+    std::size_t number = 0U;
+    const auto [ptr, ec] = std::from_chars(content->data(), content->data() + content->size(), number);
+    if (ec != std::errc()) { return std::nullopt; }
+    return number;
+}
+
+/**
+ * @brief Reads the topology of the online CPUs from cpu/online, cpu/cpuN/topology and node/nodeM/cpulist.
+ * Without core_id, the hardware threads in thread_siblings_list form a core. Missing topology files default
+ * to one package, one NUMA node and one core per CPU, as on kernels or containers which do not expose them.
+ *
+ * @param sysfsRoot Location of the sysfs system directory.
+ * @return CpuTopology An empty topology if the online CPUs cannot be determined.
+ */
+inline CpuTopology CpuTopology::fromSysfs(const std::filesystem::path &sysfsRoot) {
+    const std::filesystem::path cpuDir = sysfsRoot / "cpu";
+    const std::filesystem::path nodeDir = sysfsRoot / "node";
+
+    const std::optional<std::string> onlineList = readFile(cpuDir / "online");
+    const std::optional<std::vector<std::size_t>> online
+        = onlineList.has_value() ? parseCpuList(*onlineList) : std::nullopt;
+    if ((not online.has_value()) || online->empty()) {
+        std::cerr << "Could not read the online CPUs from " << (cpuDir / "online") << "!\n";
+        return CpuTopology();
+    }
+
+    std::vector<LogicalCpu> cpus;
+    cpus.reserve(online->size());
+    for (const std::size_t cpu : *online) {
+        const std::filesystem::path topoDir = cpuDir / ("cpu" + std::to_string(cpu)) / "topology";
+
+        std::optional<std::size_t> core = readNumber(topoDir / "core_id");
+        if (not core.has_value()) {
+            const std::optional<std::string> siblingList = readFile(topoDir / "thread_siblings_list");
+            const std::optional<std::vector<std::size_t>> siblings
+                = siblingList.has_value() ? parseCpuList(*siblingList) : std::nullopt;
+            core = (siblings.has_value() && (not siblings->empty())) ? siblings->front() : cpu;
+        }
+
+        cpus.push_back(LogicalCpu{.cpu_ = cpu,
+                                  .node_ = 0U,
+                                  .package_ = readNumber(topoDir / "physical_package_id").value_or(0U),
+                                  .core_ = *core});
+    }
+
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::directory_iterator(nodeDir, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (name.size() <= 4U || name.compare(0U, 4U, "node") != 0) { continue; }
+
+        std::size_t node = 0U;
+        const auto [ptr, err] = std::from_chars(name.data() + 4, name.data() + name.size(), node);
+        if (err != std::errc() || ptr != name.data() + name.size()) { continue; }
+
+        const std::optional<std::string> nodeList = readFile(entry.path() / "cpulist");
+        if (not nodeList.has_value()) { continue; }
+        const std::optional<std::vector<std::size_t>> nodeCpus = parseCpuList(*nodeList);
+        if (not nodeCpus.has_value()) { continue; }
+
+        for (LogicalCpu &lCpu : cpus) {
+            if (std::binary_search(nodeCpus->cbegin(), nodeCpus->cend(), lCpu.cpu_)) { lCpu.node_ = node; }
+        }
+    }
+
+    return CpuTopology(std::move(cpus));
+}
+
+inline std::size_t CpuTopology::numNodes() const {
+    std::size_t count = 0U;
+    for (std::size_t i = 0U; i < cpus_.size(); ++i) {
+        if (i == 0U || cpus_[i].node_ != cpus_[i - 1U].node_) { ++count; }
+    }
+    return count;
+}
+
+inline std::size_t CpuTopology::numPhysicalCores() const {
+    std::size_t count = 0U;
+    for (std::size_t i = 0U; i < cpus_.size(); ++i) {
+        if (i == 0U || cpus_[i].node_ != cpus_[i - 1U].node_ || cpus_[i].package_ != cpus_[i - 1U].package_
+            || cpus_[i].core_ != cpus_[i - 1U].core_) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Whether two distinct logical CPUs are hardware threads of the same physical core.
+ *
+ */
+inline bool CpuTopology::areSmtSiblings(const std::size_t cpuA, const std::size_t cpuB) const {
+    if (cpuA == cpuB) { return false; }
+
+    const auto itA = std::find_if(
+        cpus_.cbegin(), cpus_.cend(), [cpuA](const LogicalCpu &lCpu) { return lCpu.cpu_ == cpuA; });
+    const auto itB = std::find_if(
+        cpus_.cbegin(), cpus_.cend(), [cpuB](const LogicalCpu &lCpu) { return lCpu.cpu_ == cpuB; });
+    if (itA == cpus_.cend() || itB == cpus_.cend()) { return false; }
+
+    return itA->node_ == itB->node_ && itA->package_ == itB->package_ && itA->core_ == itB->core_;
+}
+
+/**
+ * @brief Whether no two of the logical CPUs are the same or SMT siblings. Unlike
+ * QNetwork::hasSeparateLogicalCores, this also rules out workers competing for the same physical core.
+ *
+ */
+inline bool CpuTopology::onSeparatePhysicalCores(const std::vector<std::size_t> &cpus) const {
+    for (std::size_t i = 0U; i < cpus.size(); ++i) {
+        for (std::size_t j = i + 1U; j < cpus.size(); ++j) {
+            if (cpus[i] == cpus[j] || areSmtSiblings(cpus[i], cpus[j])) { return false; }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief The topology restricted to the first hardware thread, i.e., the one with the lowest CPU number, of
+ * every physical core.
+ *
+ */
+inline CpuTopology CpuTopology::physicalCoresOnly() const {
+    std::vector<LogicalCpu> cpus;
+    for (std::size_t i = 0U; i < cpus_.size(); ++i) {
+        if (i == 0U || cpus_[i].node_ != cpus_[i - 1U].node_ || cpus_[i].package_ != cpus_[i - 1U].package_
+            || cpus_[i].core_ != cpus_[i - 1U].core_) {
+            cpus.push_back(cpus_[i]);
+        }
+    }
+    return CpuTopology(std::move(cpus));
+}
+
+inline void CpuTopology::print() const {
+    const std::string singleIndent = " ";
+    const std::string doubleIndent = singleIndent + singleIndent;
+
+    std::cout << "\nCpuTopology:\n";
+    std::cout << singleIndent << "#Nodes   : " << numNodes() << "\n";
+    std::cout << singleIndent << "#Cores   : " << numPhysicalCores() << "\n";
+    std::cout << singleIndent << "#CPUs    : " << numCpus() << "\n";
+    for (const LogicalCpu &cpu : cpus_) {
+        std::cout << doubleIndent << "CPU " << cpu.cpu_ << ": node " << cpu.node_ << ", package "
+                  << cpu.package_ << ", core " << cpu.core_ << "\n";
+    }
+}
+
+}        // end namespace spapq
@@ -0,0 +1,103 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#include "RingBuffer/BroadcastChannel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace spapq;
+
+TEST(BroadcastChannelTest, Functionality1) {
+    BroadcastChannel<int, 8> channel;
+    EXPECT_EQ(channel.capacity(), 8U);
+    EXPECT_EQ(channel.numPublished(), 0U);
+
+    std::size_t cursorA = 0U;
+    std::size_t cursorB = 0U;
+    std::vector<int> outA;
+    std::vector<int> outB;
+
+    EXPECT_FALSE(channel.hasNew(cursorA));
+    EXPECT_EQ(channel.read(cursorA, std::back_inserter(outA)), 0U);
+
+    for (int i = 0; i < 5; ++i) { channel.publish(i * 3); }
+    EXPECT_TRUE(channel.hasNew(cursorA));
+    EXPECT_EQ(channel.read(cursorA, std::back_inserter(outA)), 5U);
+    EXPECT_EQ(cursorA, 5U);
+    EXPECT_FALSE(channel.hasNew(cursorA));
+
+    for (int i = 5; i < 7; ++i) { channel.publish(i * 3); }
+    EXPECT_EQ(channel.read(cursorA, std::back_inserter(outA)), 2U);
+    EXPECT_EQ(channel.read(cursorB, std::back_inserter(outB)), 7U);
+
+    EXPECT_EQ(outA, std::vector<int>({0, 3, 6, 9, 12, 15, 18}));
+    EXPECT_EQ(outB, outA);
+    EXPECT_EQ(channel.numPublished(), 7U);
+}
+
+TEST(BroadcastChannelTest, Lapped) {
+    BroadcastChannel<std::size_t, 4> channel;
+
+    std::size_t cursor = 0U;
+    std::vector<std::size_t> out;
+
+    for (std::size_t i = 0U; i < 11U; ++i) { channel.publish(i); }
+
+    // Only the newest messages are retained
+    EXPECT_EQ(channel.read(cursor, std::back_inserter(out)), 4U);
+    EXPECT_EQ(cursor, 11U);
+    EXPECT_EQ(out, std::vector<std::size_t>({7U, 8U, 9U, 10U}));
+}
+
+constexpr std::size_t numMessages = 1000000U;
+
+TEST(BroadcastChannelTest, Multithread1) {
+    constexpr std::size_t numReaders = 3U;
+
+    BroadcastChannel<std::size_t, 64> channel;
+
+    std::vector<std::jthread> readers;
+    for (std::size_t reader = 0U; reader < numReaders; ++reader) {
+        readers.emplace_back([&channel]() {
+            std::size_t cursor = 0U;
+            std::size_t last = 0U;
+            std::vector<std::size_t> out;
+            while (last < numMessages) {
+                out.clear();
+                channel.read(cursor, std::back_inserter(out));
+                for (const std::size_t val : out) {
+                    // Messages arrive in order, possibly with gaps if lapped
+                    EXPECT_GT(val, last);
+                    last = val;
+                }
+            }
+            EXPECT_EQ(cursor, numMessages);
+        });
+    }
+
+    std::jthread writer([&channel]() {
+        for (std::size_t i = 1U; i <= numMessages; ++i) { channel.publish(i); }
+    });
+
+    writer.join();
+    for (auto &reader : readers) { reader.join(); }
+}
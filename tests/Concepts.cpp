@@ -18,11 +18,17 @@ limitations under the License.
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <functional>
 #include <queue>
+#include <span>
 #include <utility>
 #include <vector>
 
 #include "ParallelPriotityQueue/Concepts/BasicQueue.hpp"
+#include "ParallelPriotityQueue/Concepts/BulkExtractQueue.hpp"
+#include "ParallelPriotityQueue/Concepts/ComparableQueue.hpp"
+#include "ParallelPriotityQueue/Concepts/SerialisableTask.hpp"
 
 using namespace spapq;
 
@@ -38,3 +44,56 @@ TEST(ConceptsTest, BasicQueueTest) {
 
     EXPECT_FALSE(BasicQueue<std::vector<long unsigned>::iterator>);
 }
+
+struct SerialisableInt {
+    int val_;
+
+    std::size_t serialisedSize() const noexcept { return sizeof(int); }
+
+    void serialise(std::span<std::byte> out) const noexcept { std::memcpy(out.data(), &val_, sizeof(int)); }
+
+    static SerialisableInt deserialise(std::span<const std::byte> in) noexcept {
+        SerialisableInt task;
+        std::memcpy(&task.val_, in.data(), sizeof(int));
+        return task;
+    }
+};
+
+TEST(ConceptsTest, SerialisableTaskTest) {
+    EXPECT_TRUE(SerialisableTask<SerialisableInt>);
+
+    EXPECT_FALSE(SerialisableTask<int>);
+
+    EXPECT_FALSE(SerialisableTask<std::vector<std::byte>>);
+}
+
+struct BulkIntQueue : public std::priority_queue<int> {
+    std::size_t extractTop(int *out, const std::size_t maxCount) {
+        std::size_t numElements = 0U;
+        for (; numElements < maxCount && (not empty()); ++numElements) {
+            out[numElements] = top();
+            pop();
+        }
+        return numElements;
+    }
+};
+
+TEST(ConceptsTest, BulkExtractQueueTest) {
+    EXPECT_TRUE(BulkExtractQueue<BulkIntQueue>);
+    EXPECT_TRUE(BasicQueue<BulkIntQueue>);
+
+    EXPECT_FALSE(BulkExtractQueue<std::priority_queue<int>>);
+
+    EXPECT_FALSE(BulkExtractQueue<std::vector<int>>);
+}
+
+TEST(ConceptsTest, ComparableQueueTest) {
+    EXPECT_TRUE(ComparableQueue<std::priority_queue<int>>);
+    using MinIntQueue = std::priority_queue<int, std::vector<int>, std::greater<int>>;
+    EXPECT_TRUE(ComparableQueue<MinIntQueue>);
+    EXPECT_TRUE(ComparableQueue<BulkIntQueue>);
+
+    EXPECT_FALSE(ComparableQueue<std::queue<int>>);
+
+    EXPECT_FALSE(ComparableQueue<std::vector<int>>);
+}
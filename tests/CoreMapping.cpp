@@ -0,0 +1,130 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#include "Topology/CoreMapping.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sched.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace spapq;
+
+TEST(CoreMappingTest, StrictAndUnpinned) {
+    const std::vector<std::size_t> logicalCores = {5, 2, 7};
+    const std::vector<std::size_t> allowed = {0, 1};
+
+    EXPECT_EQ(mapLogicalCores(logicalCores, allowed, CorePinning::Strict), logicalCores);
+    EXPECT_EQ(mapLogicalCores(logicalCores, allowed, CorePinning::Unpinned),
+              std::vector<std::size_t>(3U, UNPINNED_CORE));
+}
+
+TEST(CoreMappingTest, RemapIdentity) {
+    const std::vector<std::size_t> logicalCores = {3, 1, 2, 0};
+
+    EXPECT_EQ(mapLogicalCores(logicalCores, {0, 1, 2, 3}, CorePinning::Remap), logicalCores);
+    EXPECT_EQ(mapLogicalCores(logicalCores, {0, 1, 2, 3, 4, 5, 6, 7}, CorePinning::Remap), logicalCores);
+}
+
+TEST(CoreMappingTest, RemapPreservesOrder) {
+    // E.g. a container restricted to the second socket
+    const std::vector<std::size_t> logicalCores = {0, 1, 2, 3, 4, 5, 6, 7};
+    const std::vector<std::size_t> allowed = {8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+    const std::vector<std::size_t> expected = {8, 9, 10, 11, 12, 13, 14, 15};
+    EXPECT_EQ(mapLogicalCores(logicalCores, allowed, CorePinning::Remap), expected);
+
+    const std::vector<std::size_t> permuted = {6, 0, 2, 4};
+    const std::vector<std::size_t> expectedPermuted = {11, 4, 9, 10};
+    EXPECT_EQ(mapLogicalCores(permuted, {4, 9, 10, 11, 12}, CorePinning::Remap), expectedPermuted);
+}
+
+TEST(CoreMappingTest, RemapOversubscribed) {
+    const std::vector<std::size_t> logicalCores = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    // Consecutive logical cores share a CPU
+    const std::vector<std::size_t> expected = {2, 2, 3, 3, 5, 5, 8, 8};
+    EXPECT_EQ(mapLogicalCores(logicalCores, {2, 3, 5, 8}, CorePinning::Remap), expected);
+
+    const std::vector<std::size_t> expectedSingle(8U, 6U);
+    EXPECT_EQ(mapLogicalCores(logicalCores, {6}, CorePinning::Remap), expectedSingle);
+
+    const std::vector<std::size_t> expectedThree = {1, 1, 1, 3, 3, 3, 5, 5};
+    EXPECT_EQ(mapLogicalCores(logicalCores, {1, 3, 5}, CorePinning::Remap), expectedThree);
+
+    EXPECT_EQ(mapLogicalCores(logicalCores, {}, CorePinning::Remap),
+              std::vector<std::size_t>(8U, UNPINNED_CORE));
+}
+
+TEST(CoreMappingTest, CgroupCpus) {
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "spapq_cgroup";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "cpuset");
+
+    EXPECT_FALSE(cgroupCpus(root).has_value());
+
+    // cgroup v1
+    std::ofstream(root / "cpuset" / "cpuset.effective_cpus") << "4-5,7\n";
+    EXPECT_EQ(cgroupCpus(root), std::vector<std::size_t>({4, 5, 7}));
+
+    // cgroup v2 takes precedence
+    std::ofstream(root / "cpuset.cpus.effective") << "0-2\n";
+    EXPECT_EQ(cgroupCpus(root), std::vector<std::size_t>({0, 1, 2}));
+
+    // An empty cpuset is skipped
+    std::ofstream(root / "cpuset.cpus.effective") << "\n";
+    EXPECT_EQ(cgroupCpus(root), std::vector<std::size_t>({4, 5, 7}));
+
+    std::filesystem::remove_all(root);
+}
+
+TEST(CoreMappingTest, AllowedCpus) {
+    const std::vector<std::size_t> allowed = allowedCpus();
+    ASSERT_FALSE(allowed.empty());
+    EXPECT_TRUE(std::is_sorted(allowed.cbegin(), allowed.cend()));
+
+    const int cpu = sched_getcpu();
+    if (cpu >= 0) {
+        EXPECT_TRUE(std::binary_search(allowed.cbegin(), allowed.cend(), static_cast<std::size_t>(cpu)));
+    }
+}
+
+TEST(CoreMappingTest, PinWorkerThread) {
+    EXPECT_EQ(pinThisThread(UNPINNED_CORE), EINVAL);
+
+    std::thread worker([]() {
+        const std::vector<std::size_t> allowed = allowedCpus();
+        const std::vector<std::size_t> mapping = mapLogicalCores({1000U}, allowed, CorePinning::Remap);
+        std::size_t cpu = mapping[0U];
+        pinWorkerThread(0U, cpu, CorePinning::Remap);
+        if (cpu != UNPINNED_CORE) {
+            EXPECT_EQ(cpu, allowed[0U]);
+            EXPECT_EQ(sched_getcpu(), static_cast<int>(cpu));
+        }
+
+        std::size_t unavailable = 1000000U;
+        pinWorkerThread(0U, unavailable, CorePinning::Remap);
+        EXPECT_EQ(unavailable, UNPINNED_CORE);
+    });
+    worker.join();
+}
@@ -0,0 +1,214 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#include "Topology/CpuTopology.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace spapq;
+
+/**
+ * @brief Writes a fake sysfs system directory, which is removed again on destruction.
+ *
+ */
+class FakeSysfs {
+  private:
+    const std::filesystem::path root_;
+
+  public:
+    explicit FakeSysfs(const std::string &name) :
+        root_(std::filesystem::temp_directory_path() / ("spapq_sysfs_" + name)) {
+        std::filesystem::remove_all(root_);
+        std::filesystem::create_directories(root_ / "cpu");
+    }
+
+    ~FakeSysfs() { std::filesystem::remove_all(root_); }
+
+    const std::filesystem::path &root() const { return root_; }
+
+    void write(const std::filesystem::path &file, const std::string &content) const {
+        std::filesystem::create_directories((root_ / file).parent_path());
+        std::ofstream stream(root_ / file);
+        stream << content << "\n";
+    }
+
+    void writeCpu(std::size_t cpu, std::size_t package, std::size_t core) const {
+        const std::filesystem::path topoDir
+            = std::filesystem::path("cpu") / ("cpu" + std::to_string(cpu)) / "topology";
+        write(topoDir / "physical_package_id", std::to_string(package));
+        write(topoDir / "core_id", std::to_string(core));
+    }
+};
+
+TEST(CpuTopologyTest, ParseCpuList) {
+    EXPECT_EQ(parseCpuList("0"), std::vector<std::size_t>({0}));
+    EXPECT_EQ(parseCpuList("0-3"), std::vector<std::size_t>({0, 1, 2, 3}));
+    EXPECT_EQ(parseCpuList("0-1,4-5\n"), std::vector<std::size_t>({0, 1, 4, 5}));
+    EXPECT_EQ(parseCpuList("8,2,3-4,2"), std::vector<std::size_t>({2, 3, 4, 8}));
+    EXPECT_EQ(parseCpuList(""), std::vector<std::size_t>({}));
+    EXPECT_EQ(parseCpuList("\n"), std::vector<std::size_t>({}));
+
+    EXPECT_FALSE(parseCpuList("a").has_value());
+    EXPECT_FALSE(parseCpuList("3-1").has_value());
+    EXPECT_FALSE(parseCpuList("1-").has_value());
+    EXPECT_FALSE(parseCpuList("1;2").has_value());
+    EXPECT_FALSE(parseCpuList("0-3,").has_value());
+    EXPECT_FALSE(parseCpuList("0,\n").has_value());
+    EXPECT_FALSE(parseCpuList(",").has_value());
+    EXPECT_FALSE(parseCpuList("1,,2").has_value());
+}
+
+TEST(CpuTopologyTest, Constructor) {
+    const CpuTopology topology({{.cpu_ = 3, .node_ = 1, .package_ = 1, .core_ = 0},
+                                {.cpu_ = 2, .node_ = 0, .package_ = 0, .core_ = 1},
+                                {.cpu_ = 1, .node_ = 1, .package_ = 1, .core_ = 0},
+                                {.cpu_ = 0, .node_ = 0, .package_ = 0, .core_ = 0}});
+
+    EXPECT_EQ(topology.numCpus(), 4U);
+    EXPECT_EQ(topology.numNodes(), 2U);
+    EXPECT_EQ(topology.numPhysicalCores(), 3U);
+    EXPECT_FALSE(topology.empty());
+
+    const std::vector<std::size_t> order = {0, 2, 1, 3};
+    for (std::size_t i = 0U; i < order.size(); ++i) { EXPECT_EQ(topology.cpus()[i].cpu_, order[i]); }
+
+    EXPECT_TRUE(CpuTopology().empty());
+    EXPECT_EQ(CpuTopology().numNodes(), 0U);
+}
+
+TEST(CpuTopologyTest, FromSysfsTwoNodes) {
+    // Two sockets with two cores and two hardware threads each, with Linux style numbering of the siblings
+    FakeSysfs sysfs("two_nodes");
+    sysfs.write("cpu/online", "0-7");
+    for (std::size_t cpu = 0U; cpu < 8U; ++cpu) { sysfs.writeCpu(cpu, (cpu / 2U) % 2U, cpu % 2U); }
+    sysfs.write("node/node0/cpulist", "0-1,4-5");
+    sysfs.write("node/node1/cpulist", "2-3,6-7");
+    sysfs.write("node/online", "0-1");
+
+    const CpuTopology topology = CpuTopology::fromSysfs(sysfs.root());
+    EXPECT_EQ(topology.numCpus(), 8U);
+    EXPECT_EQ(topology.numNodes(), 2U);
+    EXPECT_EQ(topology.numPhysicalCores(), 4U);
+
+    const std::vector<LogicalCpu> expected = {{.cpu_ = 0, .node_ = 0, .package_ = 0, .core_ = 0},
+                                              {.cpu_ = 4, .node_ = 0, .package_ = 0, .core_ = 0},
+                                              {.cpu_ = 1, .node_ = 0, .package_ = 0, .core_ = 1},
+                                              {.cpu_ = 5, .node_ = 0, .package_ = 0, .core_ = 1},
+                                              {.cpu_ = 2, .node_ = 1, .package_ = 1, .core_ = 0},
+                                              {.cpu_ = 6, .node_ = 1, .package_ = 1, .core_ = 0},
+                                              {.cpu_ = 3, .node_ = 1, .package_ = 1, .core_ = 1},
+                                              {.cpu_ = 7, .node_ = 1, .package_ = 1, .core_ = 1}};
+    EXPECT_EQ(topology.cpus(), expected);
+
+    topology.print();
+}
+
+TEST(CpuTopologyTest, FromSysfsOfflineCpus) {
+    FakeSysfs sysfs("offline");
+    sysfs.write("cpu/online", "0,2-3");
+    for (std::size_t cpu = 0U; cpu < 4U; ++cpu) { sysfs.writeCpu(cpu, 0U, cpu); }
+    sysfs.write("node/node0/cpulist", "0-3");
+
+    const CpuTopology topology = CpuTopology::fromSysfs(sysfs.root());
+    EXPECT_EQ(topology.numCpus(), 3U);
+    EXPECT_EQ(topology.numNodes(), 1U);
+    EXPECT_EQ(topology.cpus()[0].cpu_, 0U);
+    EXPECT_EQ(topology.cpus()[1].cpu_, 2U);
+    EXPECT_EQ(topology.cpus()[2].cpu_, 3U);
+}
+
+TEST(CpuTopologyTest, FromSysfsMissingFiles) {
+    FakeSysfs sysfs("missing");
+
+    // No cpu/online
+    EXPECT_TRUE(CpuTopology::fromSysfs(sysfs.root()).empty());
+
+    sysfs.write("cpu/online", "not a list");
+    EXPECT_TRUE(CpuTopology::fromSysfs(sysfs.root()).empty());
+
+    // Neither topology nor node directories
+    sysfs.write("cpu/online", "0-2");
+    const CpuTopology topology = CpuTopology::fromSysfs(sysfs.root());
+    EXPECT_EQ(topology.numCpus(), 3U);
+    EXPECT_EQ(topology.numNodes(), 1U);
+    EXPECT_EQ(topology.numPhysicalCores(), 3U);
+    for (std::size_t i = 0U; i < topology.numCpus(); ++i) {
+        EXPECT_EQ(topology.cpus()[i].cpu_, i);
+        EXPECT_EQ(topology.cpus()[i].package_, 0U);
+    }
+}
+
+TEST(CpuTopologyTest, SmtSiblings) {
+    FakeSysfs sysfs("smt_siblings");
+    sysfs.write("cpu/online", "0-7");
+    for (std::size_t cpu = 0U; cpu < 8U; ++cpu) { sysfs.writeCpu(cpu, (cpu / 2U) % 2U, cpu % 2U); }
+    sysfs.write("node/node0/cpulist", "0-1,4-5");
+    sysfs.write("node/node1/cpulist", "2-3,6-7");
+
+    const CpuTopology topology = CpuTopology::fromSysfs(sysfs.root());
+    EXPECT_TRUE(topology.areSmtSiblings(0U, 4U));
+    EXPECT_TRUE(topology.areSmtSiblings(7U, 3U));
+    EXPECT_FALSE(topology.areSmtSiblings(0U, 0U));
+    EXPECT_FALSE(topology.areSmtSiblings(0U, 1U));
+    EXPECT_FALSE(topology.areSmtSiblings(0U, 2U));
+    EXPECT_FALSE(topology.areSmtSiblings(0U, 42U));
+
+    EXPECT_TRUE(topology.onSeparatePhysicalCores({0, 1, 2, 3}));
+    EXPECT_FALSE(topology.onSeparatePhysicalCores({0, 1, 5}));
+    EXPECT_FALSE(topology.onSeparatePhysicalCores({2, 2}));
+
+    const CpuTopology physical = topology.physicalCoresOnly();
+    EXPECT_EQ(physical.numCpus(), 4U);
+    EXPECT_EQ(physical.numNodes(), 2U);
+    EXPECT_EQ(physical.numPhysicalCores(), 4U);
+    const std::vector<std::size_t> order = {0, 1, 2, 3};
+    for (std::size_t i = 0U; i < order.size(); ++i) { EXPECT_EQ(physical.cpus()[i].cpu_, order[i]); }
+    EXPECT_EQ(physical.physicalCoresOnly().cpus(), physical.cpus());
+}
+
+TEST(CpuTopologyTest, SmtSiblingsFromSiblingList) {
+    // No core_id files, the physical core is recovered from thread_siblings_list
+    FakeSysfs sysfs("sibling_list");
+    sysfs.write("cpu/online", "0-3");
+    sysfs.write("cpu/cpu0/topology/thread_siblings_list", "0,2");
+    sysfs.write("cpu/cpu1/topology/thread_siblings_list", "1,3");
+    sysfs.write("cpu/cpu2/topology/thread_siblings_list", "0,2");
+    sysfs.write("cpu/cpu3/topology/thread_siblings_list", "1,3");
+
+    const CpuTopology topology = CpuTopology::fromSysfs(sysfs.root());
+    EXPECT_EQ(topology.numCpus(), 4U);
+    EXPECT_EQ(topology.numPhysicalCores(), 2U);
+    EXPECT_TRUE(topology.areSmtSiblings(0U, 2U));
+    EXPECT_TRUE(topology.areSmtSiblings(1U, 3U));
+    EXPECT_FALSE(topology.areSmtSiblings(0U, 1U));
+    EXPECT_EQ(topology.physicalCoresOnly().numCpus(), 2U);
+}
+
+TEST(CpuTopologyTest, FromSysfsMachine) {
+    if (not std::filesystem::exists("/sys/devices/system/cpu/online")) { GTEST_SKIP(); }
+
+    const CpuTopology topology = CpuTopology::fromSysfs();
+    EXPECT_FALSE(topology.empty());
+    EXPECT_GE(topology.numNodes(), 1U);
+    EXPECT_LE(topology.numPhysicalCores(), topology.numCpus());
+}
@@ -321,3 +321,53 @@ TEST(DiscrepancyTablesTest, TableExpansion) {
         }
     }
 }
+
+template <std::size_t N, std::size_t tableSize>
+void expectEqualRunTimeTable(const std::array<std::size_t, N> &frequencies,
+                             const std::array<std::size_t, tableSize> &table) {
+    const std::vector<std::size_t> freqVec(frequencies.cbegin(), frequencies.cend());
+
+    const auto reducedArr = tables::reducedIntegerArray<N>(frequencies);
+    const auto reducedVec = tables::reducedIntegerArray(freqVec);
+    ASSERT_EQ(reducedVec.size(), reducedArr.size());
+    for (std::size_t i = 0U; i < reducedArr.size(); ++i) { EXPECT_EQ(reducedVec[i], reducedArr[i]); }
+
+    const auto tableVec = tables::earliestDeadlineFirstTable(freqVec);
+    ASSERT_EQ(tableVec.size(), table.size());
+    for (std::size_t i = 0U; i < table.size(); ++i) { EXPECT_EQ(tableVec[i], table[i]); }
+}
+
+TEST(DiscrepancyTablesTest, RunTimeEarliestDeadlineFirst) {
+    expectEqualRunTimeTable(testArr1, EARLIEST_DEADLINE_FIRST_TABLE(testArr1));
+    expectEqualRunTimeTable(testArr2, EARLIEST_DEADLINE_FIRST_TABLE(testArr2));
+    expectEqualRunTimeTable(testArr3, EARLIEST_DEADLINE_FIRST_TABLE(testArr3));
+    expectEqualRunTimeTable(testArr4, EARLIEST_DEADLINE_FIRST_TABLE(testArr4));
+    expectEqualRunTimeTable(testArr5, EARLIEST_DEADLINE_FIRST_TABLE(testArr5));
+    expectEqualRunTimeTable(testArr6, EARLIEST_DEADLINE_FIRST_TABLE(testArr6));
+}
+
+TEST(DiscrepancyTablesTest, RunTimeQNetworkTable) {
+    static constexpr auto graph = QNetwork<4, 8>({0, 2, 4, 6, 8},
+                                                 {0, 1, 1, 2, 2, 3, 3, 0},
+                                                 {0, 1, 2, 3},
+                                                 {2, 1, 1, 2, 3, 2, 3, 2},
+                                                 {1, 2, 1, 2, 2, 3, 6, 9});
+    const DynamicQNetwork dynGraph(graph);
+
+    auto checkWorker = [&dynGraph]<std::size_t worker>() {
+        constexpr auto tableFreq = tables::qNetworkTableFrequencies<graph, worker>();
+        const auto dynTableFreq = tables::qNetworkTableFrequencies(dynGraph, worker);
+        ASSERT_EQ(dynTableFreq.size(), tableFreq.size());
+        for (std::size_t i = 0U; i < tableFreq.size(); ++i) { EXPECT_EQ(dynTableFreq[i], tableFreq[i]); }
+
+        const auto table = tables::qNetworkTable<graph, worker>();
+        const auto dynTable = tables::qNetworkTable(dynGraph, worker);
+        ASSERT_EQ(dynTable.size(), table.size());
+        for (std::size_t i = 0U; i < table.size(); ++i) { EXPECT_EQ(dynTable[i], table[i]); }
+    };
+
+    checkWorker.template operator()<0U>();
+    checkWorker.template operator()<1U>();
+    checkWorker.template operator()<2U>();
+    checkWorker.template operator()<3U>();
+}
@@ -0,0 +1,85 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#include "ParallelPriotityQueue/Doorbell.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace spapq;
+
+TEST(DoorbellTest, Functionality1) {
+    Doorbell<150> doorbell;
+    std::vector<std::size_t> rung;
+    auto handler = [&rung](const std::size_t port) { rung.emplace_back(port); };
+
+    EXPECT_FALSE(doorbell.rung());
+    doorbell.answer(handler);
+    EXPECT_TRUE(rung.empty());
+
+    for (std::size_t port : {149U, 3U, 64U, 3U, 0U, 63U, 128U}) { doorbell.ring(port); }
+    EXPECT_TRUE(doorbell.rung());
+    doorbell.answer(handler);
+    EXPECT_FALSE(doorbell.rung());
+    EXPECT_EQ(rung, std::vector<std::size_t>({0U, 3U, 63U, 64U, 128U, 149U}));
+
+    // Answering clears the bitmap
+    rung.clear();
+    doorbell.answer(handler);
+    EXPECT_TRUE(rung.empty());
+
+    doorbell.ring(7U);
+    EXPECT_TRUE(doorbell.rung());
+    doorbell.answer(handler);
+    EXPECT_EQ(rung, std::vector<std::size_t>({7U}));
+}
+
+TEST(DoorbellTest, Multithread1) {
+    constexpr std::size_t numPorts = 4U;
+    constexpr std::size_t numRings = 100000U;
+
+    Doorbell<numPorts> doorbell;
+    std::array<std::atomic<std::size_t>, numPorts> published{};
+    std::array<std::size_t, numPorts> seen{};
+
+    std::vector<std::jthread> producers;
+    for (std::size_t port = 0U; port < numPorts; ++port) {
+        producers.emplace_back([&doorbell, &published, port]() {
+            for (std::size_t i = 1U; i <= numRings; ++i) {
+                published[port].store(i, std::memory_order_relaxed);
+                doorbell.ring(port);
+            }
+        });
+    }
+
+    bool done = false;
+    while (not done) {
+        doorbell.answer([&published, &seen](const std::size_t port) {
+            const std::size_t val = published[port].load(std::memory_order_relaxed);
+            // The published value is at least as recent as the one seen on the last ring
+            EXPECT_GE(val, seen[port]);
+            seen[port] = val;
+        });
+        done = true;
+        for (std::size_t port = 0U; port < numPorts; ++port) { done = done && (seen[port] == numRings); }
+    }
+
+    for (auto &producer : producers) { producer.join(); }
+}
@@ -0,0 +1,310 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#include "ParallelPriotityQueue/DynamicQNetwork.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "ParallelPriotityQueue/GraphExamples/FullyConnectedGraph.hpp"
+#include "ParallelPriotityQueue/GraphExamples/PetersenGraph.hpp"
+#include "ParallelPriotityQueue/GraphExamples/TopologyGraph.hpp"
+
+using namespace spapq;
+
+TEST(DynamicQNetworkTest, Constructors1) {
+    const DynamicQNetwork netw({0, 1, 2, 3, 4}, {1, 2, 3, 0}, {11, 12, 13, 14}, {10, 9, 8, 7}, {1, 2, 3, 4});
+    EXPECT_EQ(netw.numWorkers_, 4);
+    EXPECT_EQ(netw.numChannels_, 4);
+    for (std::size_t i = 0; i < 5; ++i) { EXPECT_EQ(netw.vertexPointer_[i], i); }
+    for (std::size_t i = 0; i < 4; ++i) { EXPECT_EQ(netw.logicalCore_[i], i + 11U); }
+    for (std::size_t i = 0; i < 4; ++i) { EXPECT_EQ(netw.edgeTargets_[i], (i + 1) % 4); }
+    for (std::size_t i = 0; i < 4; ++i) { EXPECT_EQ(netw.multiplicities_[i], 10U - i); }
+    for (std::size_t i = 0; i < 4; ++i) { EXPECT_EQ(netw.batchSize_[i], (i + 1)); }
+
+    EXPECT_EQ(netw.enqueueFrequency_, 16U);
+    EXPECT_EQ(netw.maxBatchSize(), 4U);
+    EXPECT_TRUE(netw.hasSeparateLogicalCores());
+    EXPECT_EQ(netw.maxPortNum(), 1U);
+    EXPECT_EQ(netw.channelBufferSize_, 64U);
+    EXPECT_TRUE(netw.isValidQNetwork());
+
+    for (std::size_t w = 0U; w < netw.numWorkers_; ++w) { EXPECT_TRUE(netw.hasPathToAllWorkers(w)); }
+    EXPECT_TRUE(netw.isStronglyConnected());
+}
+
+TEST(DynamicQNetworkTest, Constructors2) {
+    const DynamicQNetwork netw({0, 1, 2, 3, 4}, {1, 2, 3, 0});
+    EXPECT_EQ(netw.numWorkers_, 4);
+    EXPECT_EQ(netw.numChannels_, 4);
+    for (std::size_t i = 0; i < 5; ++i) { EXPECT_EQ(netw.vertexPointer_[i], i); }
+    for (std::size_t i = 0; i < 4; ++i) { EXPECT_EQ(netw.logicalCore_[i], i); }
+    for (std::size_t i = 0; i < 4; ++i) { EXPECT_EQ(netw.edgeTargets_[i], (i + 1) % 4); }
+    for (std::size_t i = 0; i < 4; ++i) { EXPECT_EQ(netw.multiplicities_[i], 1); }
+    for (std::size_t i = 0; i < 4; ++i) { EXPECT_EQ(netw.batchSize_[i], 1); }
+
+    EXPECT_TRUE(netw.hasSeparateLogicalCores());
+    EXPECT_TRUE(netw.isValidQNetwork());
+}
+
+TEST(DynamicQNetworkTest, ChannelBufferSize) {
+    const DynamicQNetwork netw({0, 1, 2, 3, 4}, {1, 2, 3, 0}, {0, 1, 2, 3}, {1, 1, 1, 1}, {5, 9, 2, 1});
+    EXPECT_EQ(netw.channelBufferSize_, 72U);
+
+    DynamicQNetwork rounded({0, 2, 4}, {0, 1, 1, 0}, {0, 1}, {1, 1, 1, 1}, {1, 2, 1, 2}, 17, 33, 6);
+    EXPECT_EQ(rounded.channelBufferSize_, 33U);
+    EXPECT_TRUE(rounded.isValidQNetwork());
+    rounded.roundUpChannelBufferSize();
+    EXPECT_EQ(rounded.channelBufferSize_, 64U);
+    EXPECT_TRUE(rounded.isValidQNetwork());
+}
+
+TEST(DynamicQNetworkTest, FromQNetwork) {
+    constexpr QNetwork<10, 30> staticNetw = PETERSEN_GRAPH;
+    const DynamicQNetwork netw(staticNetw);
+
+    EXPECT_EQ(netw.numWorkers_, staticNetw.numWorkers_);
+    EXPECT_EQ(netw.numChannels_, staticNetw.numChannels_);
+    EXPECT_EQ(netw.enqueueFrequency_, staticNetw.enqueueFrequency_);
+    EXPECT_EQ(netw.channelBufferSize_, staticNetw.channelBufferSize_);
+    EXPECT_EQ(netw.maxPushAttempts_, staticNetw.maxPushAttempts_);
+    for (std::size_t i = 0U; i < staticNetw.numWorkers_ + 1U; ++i) {
+        EXPECT_EQ(netw.vertexPointer_[i], staticNetw.vertexPointer_[i]);
+    }
+    for (std::size_t i = 0U; i < staticNetw.numWorkers_; ++i) {
+        EXPECT_EQ(netw.numPorts_[i], staticNetw.numPorts_[i]);
+        EXPECT_EQ(netw.logicalCore_[i], staticNetw.logicalCore_[i]);
+    }
+    for (std::size_t i = 0U; i < staticNetw.numChannels_; ++i) {
+        EXPECT_EQ(netw.edgeTargets_[i], staticNetw.edgeTargets_[i]);
+        EXPECT_EQ(netw.multiplicities_[i], staticNetw.multiplicities_[i]);
+        EXPECT_EQ(netw.targetPort_[i], staticNetw.targetPort_[i]);
+        EXPECT_EQ(netw.batchSize_[i], staticNetw.batchSize_[i]);
+    }
+    EXPECT_TRUE(netw.isValidQNetwork());
+}
+
+TEST(DynamicQNetworkTest, FullyConnected) {
+    for (std::size_t N : {1U, 2U, 3U, 7U, 12U}) {
+        const DynamicQNetwork netw = DYNAMIC_FULLY_CONNECTED_GRAPH(N);
+        EXPECT_EQ(netw.numWorkers_, N);
+        EXPECT_EQ(netw.numChannels_, N * N);
+        EXPECT_TRUE(netw.isValidQNetwork());
+        EXPECT_TRUE(netw.hasSeparateLogicalCores());
+        EXPECT_TRUE(netw.isStronglyConnected());
+        EXPECT_EQ(netw.maxPortNum(), N);
+    }
+
+    constexpr QNetwork<8, 64> staticNetw = FULLY_CONNECTED_GRAPH<8>();
+    const DynamicQNetwork netw = DYNAMIC_FULLY_CONNECTED_GRAPH(8U);
+    EXPECT_EQ(netw.enqueueFrequency_, staticNetw.enqueueFrequency_);
+    EXPECT_EQ(netw.channelBufferSize_, staticNetw.channelBufferSize_);
+    for (std::size_t i = 0U; i < staticNetw.numChannels_; ++i) {
+        EXPECT_EQ(netw.edgeTargets_[i], staticNetw.edgeTargets_[i]);
+        EXPECT_EQ(netw.targetPort_[i], staticNetw.targetPort_[i]);
+    }
+}
+
+TEST(DynamicQNetworkTest, TopologyAware) {
+    // Node 0 has four CPUs, node 1 has two
+    const CpuTopology topology({{.cpu_ = 0, .node_ = 0, .package_ = 0, .core_ = 0},
+                                {.cpu_ = 1, .node_ = 0, .package_ = 0, .core_ = 1},
+                                {.cpu_ = 2, .node_ = 0, .package_ = 0, .core_ = 2},
+                                {.cpu_ = 3, .node_ = 0, .package_ = 0, .core_ = 3},
+                                {.cpu_ = 8, .node_ = 1, .package_ = 1, .core_ = 0},
+                                {.cpu_ = 9, .node_ = 1, .package_ = 1, .core_ = 1}});
+
+    const TopologyGraphParameters params{.intraNodeBatchSize_ = 4U,
+                                         .intraNodeMultiplicity_ = 3U,
+                                         .interNodeBatchSize_ = 32U,
+                                         .interNodeMultiplicity_ = 1U};
+    const DynamicQNetwork netw = TOPOLOGY_AWARE_GRAPH(topology, params);
+
+    EXPECT_EQ(netw.numWorkers_, 6U);
+    EXPECT_EQ(netw.numChannels_, 4U * 5U + 2U * 3U);
+    EXPECT_TRUE(netw.isValidQNetwork());
+    EXPECT_TRUE(netw.hasSeparateLogicalCores());
+    EXPECT_TRUE(netw.isStronglyConnected());
+
+    const std::vector<std::size_t> logicalCores = {0, 1, 2, 3, 8, 9};
+    EXPECT_EQ(netw.logicalCore_, logicalCores);
+
+    const std::vector<std::size_t> nodeOfWorker = {0, 0, 0, 0, 1, 1};
+    for (std::size_t worker = 0U; worker < netw.numWorkers_; ++worker) {
+        std::size_t numInterNode = 0U;
+        for (std::size_t channel = netw.vertexPointer_[worker]; channel < netw.vertexPointer_[worker + 1U];
+             ++channel) {
+            EXPECT_EQ(netw.source(channel), worker);
+            if (nodeOfWorker[netw.target(channel)] == nodeOfWorker[worker]) {
+                EXPECT_EQ(netw.batchSize_[channel], params.intraNodeBatchSize_);
+                EXPECT_EQ(netw.multiplicities_[channel], params.intraNodeMultiplicity_);
+            } else {
+                EXPECT_EQ(netw.batchSize_[channel], params.interNodeBatchSize_);
+                EXPECT_EQ(netw.multiplicities_[channel], params.interNodeMultiplicity_);
+                ++numInterNode;
+            }
+        }
+        EXPECT_EQ(numInterNode, 1U);
+        EXPECT_EQ(netw.target(netw.vertexPointer_[worker]), worker);
+    }
+
+    // Same local rank, modulo the node size
+    EXPECT_EQ(netw.target(netw.vertexPointer_[1U] - 1U), 4U);
+    EXPECT_EQ(netw.target(netw.vertexPointer_[4U] - 1U), 5U);
+    EXPECT_EQ(netw.target(netw.vertexPointer_[5U] - 1U), 0U);
+    EXPECT_EQ(netw.target(netw.vertexPointer_[6U] - 1U), 1U);
+}
+
+TEST(DynamicQNetworkTest, TopologyAwareSmtSiblings) {
+    // One node with three physical cores, the first two having two hardware threads each
+    const CpuTopology topology({{.cpu_ = 0, .node_ = 0, .package_ = 0, .core_ = 0},
+                                {.cpu_ = 1, .node_ = 0, .package_ = 0, .core_ = 1},
+                                {.cpu_ = 2, .node_ = 0, .package_ = 0, .core_ = 2},
+                                {.cpu_ = 4, .node_ = 0, .package_ = 0, .core_ = 0},
+                                {.cpu_ = 5, .node_ = 0, .package_ = 0, .core_ = 1}});
+
+    TopologyGraphParameters params;
+    const DynamicQNetwork netw = TOPOLOGY_AWARE_GRAPH(topology, params);
+
+    EXPECT_EQ(netw.numWorkers_, 5U);
+    EXPECT_EQ(netw.numChannels_, 5U * 5U);
+    EXPECT_TRUE(netw.isValidQNetwork());
+    EXPECT_TRUE(netw.isStronglyConnected());
+
+    const std::vector<std::size_t> logicalCores = {0, 4, 1, 5, 2};
+    EXPECT_EQ(netw.logicalCore_, logicalCores);
+
+    for (std::size_t channel = 0U; channel < netw.numChannels_; ++channel) {
+        const std::size_t src = netw.source(channel);
+        const std::size_t tgt = netw.target(channel);
+        if (topology.areSmtSiblings(netw.logicalCore_[src], netw.logicalCore_[tgt])) {
+            EXPECT_EQ(netw.batchSize_[channel], params.smtSiblingBatchSize_);
+            EXPECT_EQ(netw.multiplicities_[channel], params.smtSiblingMultiplicity_);
+        } else {
+            EXPECT_EQ(netw.batchSize_[channel], params.intraNodeBatchSize_);
+            EXPECT_EQ(netw.multiplicities_[channel], params.intraNodeMultiplicity_);
+        }
+    }
+
+    params.physicalCoresOnly_ = true;
+    const DynamicQNetwork physical = TOPOLOGY_AWARE_GRAPH(topology, params);
+
+    EXPECT_EQ(physical.numWorkers_, 3U);
+    EXPECT_TRUE(physical.isValidQNetwork());
+    EXPECT_TRUE(topology.onSeparatePhysicalCores(physical.logicalCore_));
+    for (std::size_t channel = 0U; channel < physical.numChannels_; ++channel) {
+        EXPECT_EQ(physical.batchSize_[channel], params.intraNodeBatchSize_);
+        EXPECT_EQ(physical.multiplicities_[channel], params.intraNodeMultiplicity_);
+    }
+}
+
+TEST(DynamicQNetworkTest, TopologyAwareSingleNode) {
+    std::vector<LogicalCpu> cpus;
+    for (std::size_t cpu = 0U; cpu < 5U; ++cpu) {
+        cpus.push_back(LogicalCpu{.cpu_ = cpu, .node_ = 0U, .package_ = 0U, .core_ = cpu});
+    }
+
+    const DynamicQNetwork netw = TOPOLOGY_AWARE_GRAPH(CpuTopology(cpus));
+    const DynamicQNetwork fullyConnected = DYNAMIC_FULLY_CONNECTED_GRAPH(5U);
+
+    EXPECT_TRUE(netw.isValidQNetwork());
+    EXPECT_EQ(netw.vertexPointer_, fullyConnected.vertexPointer_);
+    EXPECT_EQ(netw.edgeTargets_, fullyConnected.edgeTargets_);
+    EXPECT_EQ(netw.logicalCore_, fullyConnected.logicalCore_);
+
+    EXPECT_FALSE(TOPOLOGY_AWARE_GRAPH(CpuTopology()).isValidQNetwork());
+}
+
+TEST(DynamicQNetworkTest, TopologyAwareMachine) {
+    if (not std::filesystem::exists("/sys/devices/system/cpu/online")) { GTEST_SKIP(); }
+
+    const DynamicQNetwork netw = TOPOLOGY_AWARE_GRAPH();
+    EXPECT_TRUE(netw.isValidQNetwork());
+    EXPECT_TRUE(netw.hasSeparateLogicalCores());
+    EXPECT_TRUE(netw.isStronglyConnected());
+}
+
+TEST(DynamicQNetworkTest, Validity) {
+    EXPECT_FALSE(DynamicQNetwork({}, {}).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0}, {}).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0, 2}, {0}).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0, 2, 1, 3}, {1, 2, 0}).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0, 1, 2}, {1, 3}).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0, 0, 2}, {1, 0}).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0, 1, 2}, {1, 0}, {0}).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0, 1, 2}, {1, 0}, {0, 1}, {1, 0}).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0, 1, 2}, {1, 0}, {0, 1}, {1, 1}, {1, 0}).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0, 1, 2}, {1, 0}, {0, 1}, {1, 1}, {4, 4}, 16, 2, 4).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0, 1, 2}, {1, 0}, {0, 1}, {1, 1}, {1, 1}, 16, 2, 0).isValidQNetwork());
+    EXPECT_FALSE(DynamicQNetwork({0, 1, 2}, {1, 0}, {0, 1}, {1, 1}, {1, 1}, 0, 2, 4).isValidQNetwork());
+    EXPECT_TRUE(DynamicQNetwork({0, 1, 2}, {1, 0}, {0, 1}, {1, 1}, {1, 1}, 16, 2, 4).isValidQNetwork());
+
+    DynamicQNetwork sharedPort({0, 1, 2}, {1, 0});
+    sharedPort.targetPort_[0U] = 0U;
+    EXPECT_TRUE(sharedPort.isValidQNetwork());
+    sharedPort.numPorts_[1U] = 2U;
+    sharedPort.targetPort_[0U] = 2U;
+    EXPECT_FALSE(sharedPort.isValidQNetwork());
+
+    DynamicQNetwork twoProducers({0, 1, 2, 4}, {2, 2, 0, 1});
+    EXPECT_TRUE(twoProducers.isValidQNetwork());
+    twoProducers.targetPort_[1U] = twoProducers.targetPort_[0U];
+    EXPECT_FALSE(twoProducers.isValidQNetwork());
+
+    const DynamicQNetwork sameCores({0, 1, 2}, {1, 0}, {3, 3});
+    EXPECT_TRUE(sameCores.isValidQNetwork());
+    EXPECT_FALSE(sameCores.hasSeparateLogicalCores());
+}
+
+TEST(DynamicQNetworkTest, Connectivity) {
+    const DynamicQNetwork netw1({0, 3, 5, 6}, {0, 3, 1, 3, 2, 0});
+    for (std::size_t w = 0U; w < netw1.numWorkers_; ++w) { EXPECT_TRUE(netw1.hasPathToAllWorkers(w)); }
+    EXPECT_TRUE(netw1.isStronglyConnected());
+
+    const DynamicQNetwork netw3({0, 0, 1, 4}, {1, 0, 3, 1});
+    EXPECT_FALSE(netw3.hasPathToAllWorkers(0));
+    EXPECT_FALSE(netw3.hasPathToAllWorkers(1));
+    EXPECT_TRUE(netw3.hasPathToAllWorkers(2));
+    EXPECT_FALSE(netw3.isStronglyConnected());
+
+    const DynamicQNetwork netw4({0, 1, 2, 3}, {0, 0, 2});
+    EXPECT_FALSE(netw4.isStronglyConnected());
+}
+
+TEST(DynamicQNetworkTest, SrcTgt) {
+    const DynamicQNetwork netw = DYNAMIC_FULLY_CONNECTED_GRAPH(9U);
+    for (std::size_t worker = 0U; worker < netw.numWorkers_; ++worker) {
+        for (std::size_t channel = netw.vertexPointer_[worker]; channel < netw.vertexPointer_[worker + 1U];
+             ++channel) {
+            EXPECT_EQ(netw.source(channel), worker);
+            if (channel % 9U == 0U) {
+                EXPECT_EQ(netw.target(channel), worker);
+            } else {
+                EXPECT_EQ(netw.target(channel), netw.edgeTargets_[channel]);
+            }
+        }
+    }
+    EXPECT_EQ(netw.source(100U), netw.numWorkers_);
+}
+
+TEST(DynamicQNetworkTest, PrintQNetwork) {
+    const DynamicQNetwork netw(PETERSEN_GRAPH);
+    netw.printQNetwork();
+}
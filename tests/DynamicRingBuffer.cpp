@@ -0,0 +1,151 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#include "RingBuffer/DynamicRingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace spapq;
+
+TEST(DynamicRingBufferTest, Values) {
+    std::array<int, 12> values{9, 23, 4, 1, -5, 123, 23, -23, -82, 0, 0, 1};
+
+    DynamicRingBuffer<int> channel(5U);
+    for (int val : values) {
+        bool succ = channel.push(val);
+        EXPECT_TRUE(succ);
+        EXPECT_EQ(channel.pop().value(), val);
+    }
+}
+
+TEST(DynamicRingBufferTest, Functionality) {
+    std::array<int, 12> values{9, 23, 4, 1, -5, 123, 23, -23, -82, 0, 0, 1};
+
+    for (std::size_t capacity : {1U, 5U, 6U, 8U}) {
+        DynamicRingBuffer<int> channel(capacity);
+        EXPECT_TRUE(channel.empty());
+        EXPECT_FALSE(channel.full());
+        EXPECT_EQ(channel.occupancy(), 0U);
+        EXPECT_EQ(channel.capacity(), capacity);
+
+        for (std::size_t i = 0U; i < values.size(); ++i) {
+            EXPECT_EQ(channel.occupancy(), std::min(i, capacity));
+            bool success = channel.push(values[i]);
+            EXPECT_EQ(channel.occupancy(), std::min(i + 1, capacity));
+            EXPECT_EQ(success, i < capacity);
+        }
+        EXPECT_TRUE(channel.full());
+
+        for (std::size_t i = 0U; i < values.size(); ++i) {
+            std::optional<int> result = channel.pop();
+            EXPECT_EQ(result.has_value(), i < capacity);
+            if (i < capacity) { EXPECT_EQ(result.value(), values[i]); }
+        }
+        EXPECT_TRUE(channel.empty());
+    }
+}
+
+TEST(DynamicRingBufferTest, BatchPushPop) {
+    constexpr std::size_t batch = 7U;
+    constexpr std::size_t numIt = 50U;
+
+    std::vector<int> values(numIt * batch);
+    std::iota(values.begin(), values.end(), -11);
+
+    for (std::size_t capacity : {16U, 19U}) {
+        DynamicRingBuffer<int> channel(capacity);
+        std::vector<int> out;
+
+        for (auto it = values.cbegin(); it != values.cend();) {
+            auto endIt = std::next(it, batch);
+            EXPECT_TRUE(channel.push(it, endIt));
+            it = endIt;
+
+            if (channel.occupancy() > batch) { channel.pop(std::back_inserter(out), batch + 1U); }
+        }
+        const auto tooLarge = std::next(values.cbegin(), static_cast<std::ptrdiff_t>(capacity + 1U));
+        EXPECT_FALSE(channel.push(values.cbegin(), tooLarge));
+        channel.drain(std::back_inserter(out));
+
+        EXPECT_TRUE(channel.empty());
+        EXPECT_EQ(out, values);
+    }
+}
+
+TEST(DynamicRingBufferTest, MoveOnly) {
+    DynamicRingBuffer<std::unique_ptr<int>> channel(3U);
+
+    std::unique_ptr<int> val = std::make_unique<int>(3);
+    EXPECT_TRUE(channel.push(std::move(val)));
+    EXPECT_EQ(val, nullptr);
+    EXPECT_TRUE(channel.push(std::make_unique<int>(5)));
+
+    std::array<std::unique_ptr<int>, 2U> batch{std::make_unique<int>(7), std::make_unique<int>(9)};
+    EXPECT_FALSE(channel.push(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end())));
+    EXPECT_NE(batch[0U], nullptr);
+
+    std::optional<std::unique_ptr<int>> first = channel.pop();
+    EXPECT_TRUE(first.has_value());
+    EXPECT_EQ(*first.value(), 3);
+
+    EXPECT_TRUE(channel.push(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end())));
+    EXPECT_EQ(batch[0U], nullptr);
+    EXPECT_EQ(batch[1U], nullptr);
+
+    std::vector<std::unique_ptr<int>> out;
+    EXPECT_EQ(channel.drain(std::back_inserter(out)), 3U);
+    EXPECT_TRUE(channel.empty());
+    std::array<int, 3U> expected{5, 7, 9};
+    for (std::size_t i = 0U; i < out.size(); ++i) { EXPECT_EQ(*out[i], expected[i]); }
+}
+
+TEST(DynamicRingBufferTest, Multithread) {
+    std::vector<int> values(100000);
+    for (std::size_t i = 0U; i < values.size(); ++i) { values[i] = std::rand(); }
+
+    constexpr std::size_t batch = 5U;
+    DynamicRingBuffer<int> channel(48U);
+
+    std::jthread consumer([&channel, &values]() {
+        std::vector<int> out;
+        out.reserve(values.size());
+        while (out.size() < values.size()) {
+            if (channel.pop(std::back_inserter(out), batch + 1U) == 0U) { std::this_thread::yield(); }
+        }
+        EXPECT_EQ(out, values);
+    });
+
+    std::jthread producer([&channel, &values]() {
+        for (auto it = values.cbegin(); it != values.cend();) {
+            auto endIt = std::next(it, batch);
+            while (not channel.push(it, endIt)) { std::this_thread::yield(); }
+            it = endIt;
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    EXPECT_TRUE(channel.empty());
+}
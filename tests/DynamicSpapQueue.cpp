@@ -0,0 +1,378 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#include "ParallelPriotityQueue/DynamicSpapQueue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <vector>
+
+#include "ParallelPriotityQueue/GraphExamples/FullyConnectedGraph.hpp"
+#include "ParallelPriotityQueue/GraphExamples/PetersenGraph.hpp"
+#include "ParallelPriotityQueue/GraphExamples/TopologyGraph.hpp"
+#include "ParallelPriotityQueue/WorkerExamples/FibonacciWorker.hpp"
+#include "ParallelPriotityQueue/WorkerExamples/SSSPWorker.hpp"
+
+using namespace spapq;
+
+using DivisorLocalQueueType
+    = std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>>;
+
+constexpr std::size_t divisorTestMaxSize = 2000;
+
+template <typename GlobalQType, BasicQueue LocalQType>
+class DynamicDivisorWorker final : public DynamicWorkerResource<GlobalQType, LocalQType> {
+    template <typename, template <class, BasicQueue> class, BasicQueue, std::size_t>
+    friend class DynamicSpapQueue;
+
+    using BaseT = DynamicWorkerResource<GlobalQType, LocalQType>;
+    using value_type = BaseT::value_type;
+
+  private:
+    std::vector<std::size_t> &locAnsCounter_;
+    const bool rangeEnqueue_;
+    std::vector<value_type> children_;
+
+  protected:
+    inline void processElement(value_type &&val) noexcept override {
+        ++locAnsCounter_[val];
+        if (rangeEnqueue_) {
+            children_.clear();
+            for (value_type i = 2 * val; i < divisorTestMaxSize; i += val) { children_.push_back(i); }
+            this->enqueueGlobal(children_.cbegin(), children_.cend());
+        } else {
+            for (value_type i = 2 * val; i < divisorTestMaxSize; i += val) { this->enqueueGlobal(i); }
+        }
+    }
+
+  public:
+    DynamicDivisorWorker(GlobalQType &globalQueue,
+                         const std::vector<std::size_t> &channelIndices,
+                         std::size_t workerId,
+                         std::vector<std::vector<std::size_t>> &ansCounter,
+                         bool rangeEnqueue = false) :
+        DynamicWorkerResource<GlobalQType, LocalQType>(globalQueue, channelIndices, workerId),
+        locAnsCounter_(ansCounter[workerId]),
+        rangeEnqueue_(rangeEnqueue){}
+
+    DynamicDivisorWorker(const DynamicDivisorWorker &other) = delete;
+    DynamicDivisorWorker(DynamicDivisorWorker &&other) = delete;
+    DynamicDivisorWorker &operator=(const DynamicDivisorWorker &other) = delete;
+    DynamicDivisorWorker &operator=(DynamicDivisorWorker &&other) = delete;
+    virtual ~DynamicDivisorWorker() = default;
+};
+
+using DynamicDivisorQueue = DynamicSpapQueue<std::size_t, DynamicDivisorWorker, DivisorLocalQueueType>;
+
+std::vector<std::size_t> computeAnswerDivisors(std::size_t N) {
+    std::vector<std::size_t> count(N, 1U);
+    count[0U] = 0U;
+
+    for (std::size_t i = 2U; i < count.size(); ++i) {
+        for (std::size_t j = 2U; j * j <= i; ++j) {
+            if (i % j == 0) {
+                count[i] += count[j];
+                if (j * j != i) { count[i] += count[i / j]; }
+            }
+        }
+    }
+
+    return count;
+}
+
+void checkDivisors(std::vector<std::vector<std::size_t>> &ansCounter, const std::size_t multiple = 1U) {
+    std::vector<std::size_t> solution = computeAnswerDivisors(divisorTestMaxSize);
+
+    // Tallying up from all workers
+    for (std::size_t i = 1; i < ansCounter.size(); ++i) {
+        for (std::size_t j = 0; j < divisorTestMaxSize; ++j) { ansCounter[0][j] += ansCounter[i][j]; }
+    }
+
+    for (std::size_t i = 0; i < divisorTestMaxSize; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i] * multiple); }
+}
+
+TEST(DynamicSpapQueueTest, EmptyQueue) {
+    const DynamicQNetwork netw = DYNAMIC_FULLY_CONNECTED_GRAPH(4U);
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    DynamicDivisorQueue globalQ(netw);
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    EXPECT_FALSE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+}
+
+TEST(DynamicSpapQueueTest, Destructor) {
+    std::vector<std::vector<std::size_t>> ansCounter(4U, std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    DynamicDivisorQueue globalQ(DYNAMIC_FULLY_CONNECTED_GRAPH(4U));
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+}
+
+TEST(DynamicSpapQueueTest, InvalidNetwork) {
+    std::vector<std::vector<std::size_t>> ansCounter(3U, std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    DynamicDivisorQueue invalidQ(DynamicQNetwork({0, 1, 2, 3}, {1, 0, 4}));
+    EXPECT_FALSE(invalidQ.initQueue(std::ref(ansCounter)));
+
+    DynamicDivisorQueue sharedCoreQ(DynamicQNetwork({0, 1, 2, 3}, {1, 2, 0}, {0, 1, 1}));
+    EXPECT_FALSE(sharedCoreQ.initQueue(std::ref(ansCounter)));
+
+    DynamicDivisorQueue disconnectedQ(DynamicQNetwork({0, 1, 2, 3}, {0, 0, 2}));
+    EXPECT_FALSE(disconnectedQ.initQueue(std::ref(ansCounter)));
+}
+
+TEST(DynamicSpapQueueTest, DivisorsFullyConnected) {
+    for (std::size_t numWorkers : {1U, 2U, 3U, 4U}) {
+        DynamicDivisorQueue globalQ(DYNAMIC_FULLY_CONNECTED_GRAPH(numWorkers));
+        EXPECT_EQ(globalQ.network().numWorkers_, numWorkers);
+
+        std::vector<std::vector<std::size_t>> ansCounter(numWorkers,
+                                                         std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+        EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+        globalQ.pushBeforeProcessing(1U, 0U);
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+
+        checkDivisors(ansCounter);
+    }
+}
+
+TEST(DynamicSpapQueueTest, DivisorsWidePadding) {
+    using PaddedQueue
+        = DynamicSpapQueue<std::size_t, DynamicDivisorWorker, DivisorLocalQueueType, 2U * CACHE_LINE_SIZE>;
+    static_assert(alignof(DynamicRingBuffer<std::size_t, PaddedQueue::padding_>) == 2U * CACHE_LINE_SIZE);
+
+    PaddedQueue globalQ(DYNAMIC_FULLY_CONNECTED_GRAPH(4U));
+
+    std::vector<std::vector<std::size_t>> ansCounter(4U, std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    checkDivisors(ansCounter);
+}
+
+TEST(DynamicSpapQueueTest, DivisorsHeterogeneousWorkers) {
+    constexpr QNetwork<2, 3> staticNetw({0, 1, 3}, {1, 0, 1});
+
+    std::vector<std::vector<std::size_t>> ansCounter(staticNetw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    DynamicDivisorQueue globalQ((DynamicQNetwork(staticNetw)));
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    checkDivisors(ansCounter);
+}
+
+TEST(DynamicSpapQueueTest, DivisorsBatches) {
+    // Non-power-of-two channels which only fit a few batches
+    const DynamicQNetwork netw(
+        {0, 2, 4, 6}, {0, 1, 1, 2, 2, 0}, {0, 1, 2}, {3, 1, 2, 1, 1, 1}, {1, 5, 3, 2, 4, 7}, 12, 15, 2);
+
+    for (bool rangeEnqueue : {false, true}) {
+        std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                         std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+        DynamicDivisorQueue globalQ(netw);
+        EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter), rangeEnqueue));
+        globalQ.pushBeforeProcessing(1U, 1U);
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+
+        checkDivisors(ansCounter);
+    }
+}
+
+TEST(DynamicSpapQueueTest, DivisorsPetersenGraph) {
+    DynamicDivisorQueue globalQ((DynamicQNetwork(PETERSEN_GRAPH)));
+
+    std::vector<std::vector<std::size_t>> ansCounter(globalQ.network().numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter), true));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    checkDivisors(ansCounter);
+}
+
+TEST(DynamicSpapQueueTest, DivisorsPushSafe) {
+    const DynamicQNetwork netw = DYNAMIC_FULLY_CONNECTED_GRAPH(4U);
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    DynamicDivisorQueue globalQ(netw);
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+
+    std::size_t count = 1U;
+
+    for (std::size_t channel : {0U, 4U, 8U, 12U}) {
+        if (globalQ.pushDuringProcessing(1U, channel)) { ++count; }
+    }
+
+    globalQ.waitProcessFinish();
+
+    for (std::size_t channel : {0U, 4U, 8U, 12U}) { EXPECT_FALSE(globalQ.pushDuringProcessing(1U, channel)); }
+
+    checkDivisors(ansCounter, count);
+}
+
+TEST(DynamicSpapQueueTest, ReuseQueue) {
+    const DynamicQNetwork netw = DYNAMIC_FULLY_CONNECTED_GRAPH(4U);
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    DynamicDivisorQueue globalQ(netw);
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.requestStop();
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    // Clearing counts
+    for (auto &vec : ansCounter) {
+        for (auto &val : vec) { val = 0; }
+    }
+
+    // Restarting Queue
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    checkDivisors(ansCounter);
+}
+
+TEST(DynamicSpapQueueTest, CorePinning) {
+    const std::vector<std::size_t> allowed = allowedCpus();
+
+    for (CorePinning pinning : {CorePinning::Remap, CorePinning::Unpinned}) {
+        // Logical cores which are unlikely to be available
+        DynamicQNetwork netw = DYNAMIC_FULLY_CONNECTED_GRAPH(3U);
+        netw.logicalCore_ = {1000, 1001, 1002};
+        netw.corePinning_ = pinning;
+
+        std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                         std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+        DynamicDivisorQueue globalQ(netw);
+        EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+
+        EXPECT_EQ(globalQ.workerCores().size(), netw.numWorkers_);
+        for (const std::size_t cpu : globalQ.workerCores()) {
+            if (pinning == CorePinning::Unpinned) {
+                EXPECT_EQ(cpu, UNPINNED_CORE);
+            } else if (cpu != UNPINNED_CORE) {
+                EXPECT_TRUE(std::binary_search(allowed.cbegin(), allowed.cend(), cpu));
+            }
+        }
+
+        globalQ.pushBeforeProcessing(1U, 0U);
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+
+        checkDivisors(ansCounter);
+    }
+
+    // Unpinned workers do not need separate logical cores
+    DynamicQNetwork sharedCores = DYNAMIC_FULLY_CONNECTED_GRAPH(2U);
+    sharedCores.logicalCore_ = {0, 0};
+
+    std::vector<std::vector<std::size_t>> ansCounter(sharedCores.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+    EXPECT_FALSE(DynamicDivisorQueue(sharedCores).initQueue(std::ref(ansCounter)));
+
+    sharedCores.corePinning_ = CorePinning::Unpinned;
+    DynamicDivisorQueue globalQ(sharedCores);
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    checkDivisors(ansCounter);
+}
+
+TEST(DynamicSpapQueueTest, Fibonacci) {
+    DynamicSpapQueue<std::size_t, DynamicFibonacciWorker, std::priority_queue<std::size_t>> globalQ(
+        DYNAMIC_FULLY_CONNECTED_GRAPH(3U));
+
+    EXPECT_TRUE(globalQ.initQueue());
+    globalQ.pushBeforeProcessing(20U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+}
+
+TEST(DynamicSpapQueueTest, SSSPSmtSiblings) {
+    // Two physical cores with two hardware threads each
+    const CpuTopology topology({{.cpu_ = 0, .node_ = 0, .package_ = 0, .core_ = 0},
+                                {.cpu_ = 1, .node_ = 0, .package_ = 0, .core_ = 1},
+                                {.cpu_ = 2, .node_ = 0, .package_ = 0, .core_ = 0},
+                                {.cpu_ = 3, .node_ = 0, .package_ = 0, .core_ = 1}});
+
+    DynamicSpapQueue<std::array<unsigned, 2U>,
+                     DynamicSSSPWorker,
+                     std::priority_queue<std::array<unsigned, 2U>,
+                                         std::vector<std::array<unsigned, 2U>>,
+                                         std::greater<std::array<unsigned, 2U>>>>
+        globalQ(TOPOLOGY_AWARE_GRAPH(topology));
+
+    // Cycle
+    constexpr unsigned nVerts = 5000U;
+    CSRGraph graph;
+    for (unsigned vert = 0U; vert < nVerts; ++vert) {
+        graph.sourcePointers_.emplace_back(graph.edgeTargets_.size());
+        graph.edgeTargets_.emplace_back((vert + 1U) % nVerts);
+        graph.edgeTargets_.emplace_back((vert + nVerts - 1U) % nVerts);
+    }
+    graph.sourcePointers_.emplace_back(graph.edgeTargets_.size());
+
+    std::vector<std::atomic<unsigned>> distances(nVerts);
+    for (auto &dist : distances) {
+        dist.store(std::numeric_limits<unsigned>::max(), std::memory_order_relaxed);
+    }
+    distances[0].store(0U, std::memory_order_relaxed);
+
+    EXPECT_TRUE(globalQ.initQueue(std::cref(graph), std::ref(distances)));
+    globalQ.pushBeforeProcessing({0U, 0U}, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    for (unsigned vert = 0U; vert < nVerts; ++vert) {
+        EXPECT_EQ(distances[vert].load(std::memory_order_relaxed), std::min(vert, nVerts - vert));
+    }
+}
@@ -0,0 +1,145 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#include "RingBuffer/MPSCRingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace spapq;
+
+TEST(MPSCRingBufferTest, Functionality1) {
+    std::array<int, 7> values{9, 23, 4, 1, -5, 123, 23};
+
+    MPSCRingBuffer<int, 5> channel;
+    EXPECT_EQ(channel.capacity(), 5U);
+    EXPECT_TRUE(channel.empty());
+    EXPECT_FALSE(channel.pop());
+
+    for (std::size_t i = 0U; i < 5U; ++i) {
+        EXPECT_TRUE(channel.push(values[i]));
+        EXPECT_EQ(channel.occupancy(), i + 1U);
+    }
+    EXPECT_TRUE(channel.full());
+    EXPECT_FALSE(channel.push(values[5U]));
+
+    for (std::size_t i = 0U; i < 3U; ++i) {
+        std::optional<int> result = channel.pop();
+        EXPECT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), values[i]);
+    }
+
+    EXPECT_TRUE(channel.push(values[5U]));
+    EXPECT_TRUE(channel.push(values[6U]));
+
+    int val = 0;
+    for (std::size_t i = 3U; i < 7U; ++i) {
+        EXPECT_TRUE(channel.pop(val));
+        EXPECT_EQ(val, values[i]);
+    }
+    EXPECT_FALSE(channel.pop(val));
+    EXPECT_TRUE(channel.empty());
+}
+
+TEST(MPSCRingBufferTest, BatchPushPop) {
+    constexpr std::size_t batch = 7U;
+    constexpr std::size_t numIt = 50U;
+
+    std::vector<int> values(numIt * batch);
+    std::iota(values.begin(), values.end(), -11);
+
+    MPSCRingBuffer<int, 15> channel;
+    EXPECT_FALSE(channel.push(values.cbegin(), std::next(values.cbegin(), 16)));
+    EXPECT_TRUE(channel.empty());
+
+    std::vector<int> out;
+    for (auto it = values.cbegin(); it != values.cend();) {
+        auto endIt = std::next(it, batch);
+        EXPECT_TRUE(channel.push(it, endIt));
+        it = endIt;
+
+        if (channel.occupancy() > batch) { channel.pop(std::back_inserter(out), batch + 1U); }
+    }
+    EXPECT_EQ(channel.pop(std::back_inserter(out), 0U), 0U);
+    channel.drain(std::back_inserter(out));
+
+    EXPECT_TRUE(channel.empty());
+    EXPECT_EQ(out, values);
+}
+
+TEST(MPSCRingBufferTest, MoveOnly) {
+    MPSCRingBuffer<std::unique_ptr<int>, 4> channel;
+
+    std::unique_ptr<int> val = std::make_unique<int>(3);
+    EXPECT_TRUE(channel.push(std::move(val)));
+    EXPECT_EQ(val, nullptr);
+
+    std::array<std::unique_ptr<int>, 3U> batch{
+        std::make_unique<int>(5), std::make_unique<int>(7), std::make_unique<int>(9)};
+    EXPECT_TRUE(channel.push(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end())));
+
+    val = std::make_unique<int>(11);
+    EXPECT_FALSE(channel.push(std::move(val)));
+    EXPECT_NE(val, nullptr);
+
+    std::vector<std::unique_ptr<int>> out;
+    EXPECT_EQ(channel.drain(std::back_inserter(out)), 4U);
+    std::array<int, 4U> expected{3, 5, 7, 9};
+    for (std::size_t i = 0U; i < out.size(); ++i) { EXPECT_EQ(*out[i], expected[i]); }
+}
+
+TEST(MPSCRingBufferTest, Multithread1) {
+    constexpr std::size_t numProducers = 3U;
+    constexpr std::size_t numValues = 100000U;
+    constexpr std::size_t batch = 5U;
+
+    MPSCRingBuffer<std::size_t, 64> channel;
+
+    std::vector<std::jthread> producers;
+    for (std::size_t p = 0U; p < numProducers; ++p) {
+        producers.emplace_back([&channel, p]() {
+            std::array<std::size_t, batch> vals;
+            for (std::size_t i = 0U; i < numValues; i += batch) {
+                for (std::size_t j = 0U; j < batch; ++j) { vals[j] = (p * numValues) + i + j; }
+                while (not channel.push(vals.cbegin(), vals.cend())) { }
+            }
+        });
+    }
+
+    std::vector<std::size_t> next(numProducers);
+    for (std::size_t p = 0U; p < numProducers; ++p) { next[p] = p * numValues; }
+
+    std::vector<std::size_t> out;
+    std::size_t received = 0U;
+    while (received < numProducers * numValues) {
+        out.clear();
+        received += channel.drain(std::back_inserter(out));
+        for (const std::size_t val : out) {
+            const std::size_t p = val / numValues;
+            EXPECT_EQ(val, next[p]);        // Order per producer is preserved
+            ++next[p];
+        }
+    }
+
+    for (auto &producer : producers) { producer.join(); }
+    EXPECT_TRUE(channel.empty());
+}
@@ -65,6 +65,91 @@ TEST(QNetworkTest, Constructors2) {
     EXPECT_TRUE(netw.hasSeparateLogicalCores());
 }
 
+TEST(QNetworkTest, FalseSharingPadding) {
+    QNetwork<4, 16> padded = FULLY_CONNECTED_GRAPH<4U>();
+    EXPECT_EQ(padded.falseSharingPadding_, CACHE_LINE_SIZE);
+    padded.falseSharingPadding_ = 2U * CACHE_LINE_SIZE;
+    EXPECT_TRUE(padded.isValidQNetwork());
+    padded.falseSharingPadding_ = 96U;
+    EXPECT_FALSE(padded.isValidQNetwork());
+    padded.falseSharingPadding_ = 1U;
+    EXPECT_FALSE(padded.isValidQNetwork());
+}
+
+TEST(QNetworkTest, ChannelBufferSize) {
+    constexpr QNetwork<4, 4> netw({0, 1, 2, 3, 4}, {1, 2, 3, 0}, {0, 1, 2, 3}, {1, 1, 1, 1}, {5, 9, 2, 1});
+    EXPECT_EQ(netw.channelBufferSize_, 72U);
+
+    constexpr auto rounded = []() {
+        QNetwork<2, 4> graph({0, 2, 4}, {0, 1, 1, 0}, {0, 1}, {1, 1, 1, 1}, {1, 2, 1, 2}, 17, 33, 6);
+        graph.roundUpChannelBufferSize();
+        return graph;
+    }();
+    EXPECT_EQ(rounded.channelBufferSize_, 64U);
+    EXPECT_TRUE(rounded.isValidQNetwork());
+}
+
+TEST(QNetworkTest, MergeInPorts) {
+    constexpr auto merged = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.mergeInPorts();
+        return graph;
+    }();
+    EXPECT_EQ(merged.channelKind_, ChannelKind::MPSCRing);
+    EXPECT_TRUE(merged.isValidQNetwork());
+    EXPECT_EQ(merged.maxPortNum(), 1U);
+    for (std::size_t w = 0U; w < merged.numWorkers_; ++w) { EXPECT_EQ(merged.inDegree(w), 1U); }
+    for (std::size_t i = 0U; i < merged.numChannels_; ++i) { EXPECT_EQ(merged.targetPort_[i], 0U); }
+
+    constexpr auto paired = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.mergeInPorts(3U);
+        return graph;
+    }();
+    EXPECT_EQ(paired.channelKind_, ChannelKind::MPSCRing);
+    EXPECT_TRUE(paired.isValidQNetwork());
+    for (std::size_t w = 0U; w < paired.numWorkers_; ++w) { EXPECT_EQ(paired.inDegree(w), 2U); }
+
+    constexpr auto unmerged = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.mergeInPorts(1U);
+        return graph;
+    }();
+    constexpr QNetwork<4, 16> full = FULLY_CONNECTED_GRAPH<4U>();
+    EXPECT_EQ(unmerged.channelKind_, ChannelKind::SPSCRing);
+    EXPECT_TRUE(unmerged.isValidQNetwork());
+    for (std::size_t w = 0U; w < unmerged.numWorkers_; ++w) { EXPECT_EQ(unmerged.inDegree(w), 4U); }
+    for (std::size_t i = 0U; i < full.numChannels_; ++i) {
+        EXPECT_EQ(unmerged.targetPort_[i], full.targetPort_[i]);
+    }
+
+    QNetwork<4, 16> shared = FULLY_CONNECTED_GRAPH<4U>();
+    shared.targetPort_[1U] = shared.targetPort_[4U];
+    EXPECT_FALSE(shared.isValidQNetwork());
+    shared.channelKind_ = ChannelKind::MPSCRing;
+    EXPECT_TRUE(shared.isValidQNetwork());
+}
+
+TEST(QNetworkTest, DrainQuotas) {
+    constexpr QNetwork<4, 16> full = FULLY_CONNECTED_GRAPH<4U>();
+    EXPECT_FALSE(full.hasBoundedDraining());
+
+    constexpr auto quotas = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.setDrainQuotasFromMultiplicities(2U);
+        return graph;
+    }();
+    EXPECT_TRUE(quotas.hasBoundedDraining());
+    EXPECT_TRUE(quotas.isValidQNetwork());
+    for (std::size_t i = 0U; i < quotas.numChannels_; ++i) {
+        EXPECT_EQ(quotas.drainQuota_[i], quotas.multiplicities_[i] * quotas.batchSize_[i] * 2U);
+    }
+
+    QNetwork<4, 16> budget = FULLY_CONNECTED_GRAPH<4U>();
+    budget.drainBudget_ = 8U;
+    EXPECT_TRUE(budget.hasBoundedDraining());
+}
+
 TEST(QNetworkTest, Ports1) {
     constexpr QNetwork<4, 4> netw({0, 1, 2, 3, 4}, {1, 2, 3, 0}, {10, 0, 3, 10});
     std::vector<std::vector<std::size_t>> outGraph(netw.numWorkers_);
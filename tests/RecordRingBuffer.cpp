@@ -0,0 +1,208 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#include "RingBuffer/RecordRingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "RingBuffer/RecordChannel.hpp"
+
+using namespace spapq;
+
+std::vector<std::byte> makeRecord(const std::size_t size, const std::size_t seed) {
+    std::vector<std::byte> record(size);
+    for (std::size_t i = 0U; i < size; ++i) { record[i] = static_cast<std::byte>((seed + i) % 256U); }
+    return record;
+}
+
+/**
+ * @brief A task with a variable number of values.
+ *
+ */
+struct VarTask {
+    std::vector<std::size_t> values_;
+
+    inline std::size_t serialisedSize() const noexcept { return values_.size() * sizeof(std::size_t); }
+
+    inline void serialise(std::span<std::byte> out) const noexcept {
+        std::memcpy(out.data(), values_.data(), out.size());
+    }
+
+    static inline VarTask deserialise(std::span<const std::byte> in) noexcept {
+        VarTask task;
+        task.values_.resize(in.size() / sizeof(std::size_t));
+        std::memcpy(task.values_.data(), in.data(), in.size());
+        return task;
+    }
+
+    inline bool operator==(const VarTask &other) const noexcept = default;
+};
+
+TEST(RecordRingBufferTest, Functionality1) {
+    RecordRingBuffer<256> channel;
+    EXPECT_EQ(channel.capacity(), 256U);
+    EXPECT_EQ(channel.maxRecordSize(), 120U);
+    EXPECT_TRUE(channel.empty());
+
+    std::vector<std::vector<std::byte>> records;
+    for (std::size_t size : {0U, 1U, 8U, 13U, 40U}) { records.emplace_back(makeRecord(size, size)); }
+
+    for (const auto &record : records) { EXPECT_TRUE(channel.push(record)); }
+    EXPECT_FALSE(channel.empty());
+    // Headers and payloads padded to the header size
+    EXPECT_EQ(channel.occupancy(), 5U * 8U + 0U + 8U + 8U + 16U + 40U);
+    EXPECT_FALSE(channel.push(makeRecord(121U, 0U)));
+
+    std::vector<std::vector<std::byte>> out;
+    auto reader = [&out](std::span<const std::byte> record) {
+        out.emplace_back(record.begin(), record.end());
+    };
+    EXPECT_EQ(channel.pop(reader, 2U), 2U);
+    EXPECT_EQ(channel.drain(reader), 3U);
+    EXPECT_EQ(channel.drain(reader), 0U);
+
+    EXPECT_TRUE(channel.empty());
+    EXPECT_EQ(out, records);
+}
+
+TEST(RecordRingBufferTest, WrapAround) {
+    RecordRingBuffer<128> channel;
+
+    std::vector<std::vector<std::byte>> records;
+    std::vector<std::vector<std::byte>> out;
+    auto reader = [&out](std::span<const std::byte> record) {
+        out.emplace_back(record.begin(), record.end());
+    };
+
+    for (std::size_t i = 0U; i < 500U; ++i) {
+        records.emplace_back(makeRecord((i * 7U) % (channel.maxRecordSize() + 1U), i));
+        while (not channel.push(records.back())) { EXPECT_EQ(channel.pop(reader, 1U), 1U); }
+        EXPECT_LE(channel.occupancy(), channel.capacity());
+    }
+    channel.drain(reader);
+
+    EXPECT_TRUE(channel.empty());
+    EXPECT_EQ(out, records);
+}
+
+TEST(RecordRingBufferTest, PublishDiscard) {
+    RecordRingBuffer<64> channel;
+    const std::vector<std::byte> record = makeRecord(8U, 3U);
+    auto writer = [&record](std::span<std::byte> slot) {
+        std::copy(record.begin(), record.end(), slot.begin());
+    };
+
+    EXPECT_TRUE(channel.write(record.size(), writer));
+    EXPECT_TRUE(channel.write(record.size(), writer));
+    EXPECT_TRUE(channel.empty());
+
+    channel.discard();
+    EXPECT_TRUE(channel.empty());
+
+    EXPECT_TRUE(channel.write(record.size(), writer));
+    EXPECT_TRUE(channel.write(record.size(), writer));
+    EXPECT_TRUE(channel.write(record.size(), writer));
+    EXPECT_TRUE(channel.write(record.size(), writer));
+    EXPECT_FALSE(channel.write(record.size(), writer));
+    channel.publish();
+    EXPECT_EQ(channel.occupancy(), 64U);
+
+    std::size_t count = 0U;
+    EXPECT_EQ(channel.drain([&count, &record](std::span<const std::byte> slot) {
+        EXPECT_TRUE(std::equal(slot.begin(), slot.end(), record.begin(), record.end()));
+        ++count;
+    }),
+              4U);
+    EXPECT_EQ(count, 4U);
+    EXPECT_TRUE(channel.empty());
+}
+
+TEST(RecordRingBufferTest, RecordChannel) {
+    RecordChannel<VarTask, 256> channel;
+    EXPECT_FALSE(channel.pop());
+
+    std::vector<VarTask> tasks;
+    for (std::size_t i = 0U; i < 100U; ++i) {
+        VarTask task;
+        task.values_.resize(i % 6U);
+        std::iota(task.values_.begin(), task.values_.end(), i);
+        tasks.emplace_back(std::move(task));
+    }
+
+    std::vector<VarTask> out;
+    for (auto it = tasks.cbegin(); it != tasks.cend();) {
+        auto endIt = std::next(it, 2);
+        EXPECT_TRUE(channel.push(it, endIt));
+        it = endIt;
+
+        while (channel.occupancy() > 64U) { channel.pop(std::back_inserter(out), 1U); }
+    }
+
+    // Batches are pushed all or nothing
+    const std::size_t occupancy = channel.occupancy();
+    EXPECT_FALSE(channel.push(tasks.cbegin(), tasks.cend()));
+    EXPECT_EQ(channel.occupancy(), occupancy);
+
+    channel.drain(std::back_inserter(out));
+    EXPECT_TRUE(channel.empty());
+    EXPECT_EQ(out, tasks);
+
+    VarTask val;
+    EXPECT_TRUE(channel.push(tasks[5]));
+    EXPECT_TRUE(channel.pop(val));
+    EXPECT_EQ(val, tasks[5]);
+}
+
+TEST(RecordRingBufferTest, Multithread1) {
+    std::vector<std::vector<std::byte>> records(200000);
+    for (std::size_t i = 0U; i < records.size(); ++i) {
+        records[i] = makeRecord(static_cast<std::size_t>(std::rand()) % 100U, i);
+    }
+
+    RecordRingBuffer<1024> channel;
+
+    std::jthread consumer([&channel, &records]() {
+        std::size_t cntr = 0U;
+        while (cntr < records.size()) {
+            channel.pop(
+                [&cntr, &records](std::span<const std::byte> record) {
+                    EXPECT_TRUE(std::equal(
+                        record.begin(), record.end(), records[cntr].begin(), records[cntr].end()));
+                    ++cntr;
+                },
+                10U);
+        }
+    });
+
+    std::jthread producer([&channel, &records]() {
+        for (const auto &record : records) {
+            while (not channel.push(record)) { }
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    EXPECT_TRUE(channel.empty());
+}
@@ -20,7 +20,9 @@ limitations under the License.
 
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <numeric>
+#include <span>
 #include <thread>
 
 using namespace spapq;
@@ -179,6 +181,225 @@ TEST(RingBufferTest, BatchPush) {
     }
 }
 
+TEST(RingBufferTest, BatchPop) {
+    std::array<int, 12> values{9, 23, 4, 1, -5, 123, 23, -23, -82, 0, 0, 1};
+    std::vector<int> out;
+
+    RingBuffer<int, 5> channel;
+    EXPECT_EQ(channel.pop(std::back_inserter(out), 3U), 0U);
+    EXPECT_TRUE(out.empty());
+
+    auto it = values.cbegin();
+    std::advance(it, 4);
+    EXPECT_TRUE(channel.push(values.cbegin(), it));
+
+    EXPECT_EQ(channel.pop(std::back_inserter(out), 3U), 3U);
+    EXPECT_EQ(channel.occupancy(), 1U);
+    EXPECT_EQ(out, std::vector<int>({9, 23, 4}));
+
+    auto endIt = std::next(it, 3);
+    EXPECT_TRUE(channel.push(it, endIt));
+    EXPECT_EQ(channel.occupancy(), 4U);
+
+    // Wraps around the end of the buffer
+    EXPECT_EQ(channel.pop(std::back_inserter(out), 10U), 4U);
+    EXPECT_EQ(out, std::vector<int>({9, 23, 4, 1, -5, 123, 23}));
+    EXPECT_TRUE(channel.empty());
+
+    EXPECT_TRUE(channel.push(endIt, values.cend()));
+    EXPECT_EQ(channel.pop(std::back_inserter(out), 0U), 0U);
+    EXPECT_TRUE(channel.full());
+    EXPECT_EQ(channel.drain(std::back_inserter(out)), 5U);
+    EXPECT_TRUE(channel.empty());
+    EXPECT_EQ(out, std::vector<int>(values.cbegin(), values.cend()));
+}
+
+TEST(RingBufferTest, BatchPushPop) {
+    constexpr std::size_t batch = 7U;
+    constexpr std::size_t numIt = 50U;
+
+    std::vector<int> values(numIt * batch);
+    std::iota(values.begin(), values.end(), -11);
+
+    RingBuffer<int, 16> channel;
+    std::vector<int> out;
+
+    for (auto it = values.cbegin(); it != values.cend();) {
+        auto endIt = std::next(it, batch);
+        EXPECT_TRUE(channel.push(it, endIt));
+        it = endIt;
+
+        if (channel.occupancy() > batch) { channel.pop(std::back_inserter(out), batch + 1U); }
+    }
+    channel.drain(std::back_inserter(out));
+
+    EXPECT_TRUE(channel.empty());
+    EXPECT_EQ(out, values);
+}
+
+TEST(RingBufferTest, PushStreaming) {
+    constexpr std::size_t batch = 20U;
+    constexpr std::size_t numIt = 50U;
+
+    std::vector<int> values(numIt * batch);
+    std::iota(values.begin(), values.end(), 5);
+
+    RingBuffer<int, 41> channel;
+    std::vector<int> out;
+
+    for (auto it = values.cbegin(); it != values.cend();) {
+        auto endIt = std::next(it, batch);
+        EXPECT_TRUE(channel.pushStreaming(it, endIt));
+        it = endIt;
+
+        if (channel.occupancy() > batch) { channel.pop(std::back_inserter(out), batch + 3U); }
+    }
+    EXPECT_FALSE(channel.pushStreaming(values.cbegin(), std::next(values.cbegin(), 2U * batch)));
+
+    // Small batches take the regular path
+    channel.drain(std::back_inserter(out));
+    EXPECT_TRUE(channel.pushStreaming(values.cbegin(), std::next(values.cbegin(), 3)));
+    channel.drain(std::back_inserter(out));
+
+    EXPECT_TRUE(channel.empty());
+    values.insert(values.end(), values.cbegin(), std::next(values.cbegin(), 3));
+    EXPECT_EQ(out, values);
+}
+
+template <std::size_t padding>
+void checkPushStreamingPadding() {
+    std::vector<long> values(64U);
+    std::iota(values.begin(), values.end(), 1L);
+
+    RingBuffer<long, 37, false, padding> channel;
+    std::vector<long> out;
+
+    // Batches below and above the streaming threshold of the padding, wrapping around the end of the buffer
+    for (const std::size_t batch : {std::size_t{3U}, std::size_t{8U}, std::size_t{17U}, std::size_t{32U}}) {
+        for (auto it = values.cbegin(); it != values.cend();) {
+            auto endIt = std::next(it, static_cast<std::ptrdiff_t>(batch));
+            if (endIt > values.cend()) { endIt = values.cend(); }
+            EXPECT_TRUE(channel.pushStreaming(it, endIt));
+            it = endIt;
+            channel.drain(std::back_inserter(out));
+        }
+        EXPECT_EQ(out, values);
+        out.clear();
+    }
+}
+
+TEST(RingBufferTest, PushStreamingPadding) {
+    checkPushStreamingPadding<alignof(std::size_t)>();
+    checkPushStreamingPadding<4U * CACHE_LINE_SIZE>();
+}
+
+TEST(RingBufferTest, ReserveCommit) {
+    RingBuffer<int, 6> channel;
+
+    std::array<std::span<int>, 2U> reservation = channel.reserve(7U);
+    EXPECT_TRUE(reservation[0U].empty());
+    EXPECT_TRUE(reservation[1U].empty());
+
+    reservation = channel.reserve(4U);
+    EXPECT_EQ(reservation[0U].size(), 4U);
+    EXPECT_TRUE(reservation[1U].empty());
+    std::iota(reservation[0U].begin(), reservation[0U].end(), 1);
+
+    EXPECT_TRUE(channel.empty());
+    channel.commit(3U);
+    EXPECT_EQ(channel.occupancy(), 3U);
+
+    for (int val : {1, 2, 3}) { EXPECT_EQ(channel.pop().value(), val); }
+    EXPECT_TRUE(channel.empty());
+
+    // Wraps around the end of the buffer
+    reservation = channel.reserve(5U);
+    EXPECT_EQ(reservation[0U].size(), 3U);
+    EXPECT_EQ(reservation[1U].size(), 2U);
+    std::iota(reservation[0U].begin(), reservation[0U].end(), 10);
+    std::iota(reservation[1U].begin(), reservation[1U].end(), 13);
+    channel.commit(5U);
+
+    EXPECT_EQ(channel.occupancy(), 5U);
+    EXPECT_TRUE(channel.reserve(2U)[0U].empty());
+    for (int val : {10, 11, 12, 13, 14}) { EXPECT_EQ(channel.pop().value(), val); }
+    EXPECT_TRUE(channel.empty());
+}
+
+TEST(RingBufferTest, Wait) {
+    WaitableRingBuffer<int, 6> channel;
+    EXPECT_EQ(channel.capacity(), 6U);
+
+    channel.pushWait(1);
+    const int two = 2;
+    channel.pushWait(two);
+    std::array<int, 4> values{3, 4, 5, 6};
+    channel.pushWait(values.cbegin(), values.cend());
+    EXPECT_TRUE(channel.full());
+
+    EXPECT_EQ(channel.popWait(), 1);
+    EXPECT_EQ(channel.popWait(), 2);
+
+    std::vector<int> out;
+    EXPECT_EQ(channel.popWait(std::back_inserter(out), 3U), 3U);
+    EXPECT_EQ(out, std::vector<int>({3, 4, 5}));
+    EXPECT_EQ(channel.popWait(std::back_inserter(out), 3U), 1U);
+    EXPECT_TRUE(channel.empty());
+}
+
+TEST(RingBufferTest, WaitLargerThanCapacity) {
+    // A range larger than the capacity is pushed in chunks instead of waiting for space which never comes
+    std::vector<int> values(3U * 6U + 2U);
+    for (std::size_t i = 0; i < values.size(); ++i) { values[i] = static_cast<int>(i); }
+
+    WaitableRingBuffer<int, 6> channel;
+
+    std::jthread consumer([&channel, &values]() {
+        std::vector<int> out;
+        while (out.size() < values.size()) { channel.popWait(std::back_inserter(out), values.size()); }
+        EXPECT_EQ(out, values);
+    });
+
+    channel.pushWait(values.cbegin(), values.cend());
+    consumer.join();
+
+    EXPECT_TRUE(channel.empty());
+}
+
+TEST(RingBufferTest, MoveOnly) {
+    RingBuffer<std::unique_ptr<int>, 4> channel;
+
+    std::unique_ptr<int> val = std::make_unique<int>(3);
+    EXPECT_TRUE(channel.push(std::move(val)));
+    EXPECT_EQ(val, nullptr);
+    EXPECT_TRUE(channel.push(std::make_unique<int>(5)));
+    EXPECT_TRUE(channel.push(std::make_unique<int>(7)));
+    EXPECT_TRUE(channel.push(std::make_unique<int>(9)));
+
+    val = std::make_unique<int>(11);
+    EXPECT_FALSE(channel.push(std::move(val)));
+    EXPECT_NE(val, nullptr);
+
+    std::optional<std::unique_ptr<int>> first = channel.pop();
+    EXPECT_TRUE(first.has_value());
+    EXPECT_EQ(*first.value(), 3);
+
+    std::unique_ptr<int> second;
+    EXPECT_TRUE(channel.pop(second));
+    EXPECT_EQ(*second, 5);
+
+    std::array<std::unique_ptr<int>, 2U> batch{std::make_unique<int>(13), std::make_unique<int>(15)};
+    EXPECT_TRUE(channel.push(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end())));
+    EXPECT_EQ(batch[0U], nullptr);
+    EXPECT_EQ(batch[1U], nullptr);
+
+    std::vector<std::unique_ptr<int>> out;
+    EXPECT_EQ(channel.drain(std::back_inserter(out)), 4U);
+    EXPECT_TRUE(channel.empty());
+    std::array<int, 4U> expected{7, 9, 13, 15};
+    for (std::size_t i = 0U; i < out.size(); ++i) { EXPECT_EQ(*out[i], expected[i]); }
+}
+
 TEST(RingBufferTest, Multithread1) {
     std::vector<int> values(100000);
     for (std::size_t i = 0U; i < values.size(); ++i) { values[i] = std::rand(); }
@@ -311,6 +532,73 @@ TEST(RingBufferTest, Multithread4) {
     EXPECT_TRUE(channel.empty());
 }
 
+TEST(RingBufferTest, Multithread5) {
+    std::vector<long> values(1000000);
+    for (std::size_t i = 0; i < values.size(); ++i) { values[i] = std::rand(); }
+
+    constexpr std::size_t capacity = 16U;
+    RingBuffer<long, capacity> channel;
+    EXPECT_EQ(capacity, channel.capacity());
+
+    std::jthread consumer([&channel, &values]() {
+        std::vector<long> out;
+        out.reserve(values.size());
+        while (out.size() < values.size()) {
+            const std::size_t numPopped = channel.drain(std::back_inserter(out));
+            EXPECT_LE(numPopped, channel.capacity());
+        }
+        EXPECT_TRUE(channel.empty());
+        EXPECT_EQ(out, values);
+    });
+
+    std::jthread producer([&channel, &values]() {
+        for (std::size_t i = 0U; i < values.size(); ++i) {
+            while (!channel.push(values[i])) { }
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    EXPECT_TRUE(channel.empty());
+}
+
+TEST(RingBufferTest, Multithread6) {
+    // Sleeping producers and consumers are slow, hence fewer values. The size leaves a tail of single pushes.
+    std::vector<long> values(10003);
+    for (std::size_t i = 0; i < values.size(); ++i) { values[i] = std::rand(); }
+
+    constexpr std::size_t capacity = 16U;
+    WaitableRingBuffer<long, capacity> channel;
+
+    std::jthread consumer([&channel, &values]() {
+        std::vector<long> out;
+        out.reserve(values.size());
+        for (std::size_t i = 0U; i < values.size() / 2U; ++i) { out.emplace_back(channel.popWait()); }
+        while (out.size() < values.size()) {
+            const std::size_t numPopped = channel.popWait(std::back_inserter(out), capacity);
+            EXPECT_LE(numPopped, channel.capacity());
+        }
+        EXPECT_TRUE(channel.empty());
+        EXPECT_EQ(out, values);
+    });
+
+    std::jthread producer([&channel, &values]() {
+        std::size_t i = 0U;
+        for (; i < values.size() / 2U; ++i) { channel.pushWait(values[i]); }
+        for (; i + 4U <= values.size(); i += 4U) {
+            auto first = values.cbegin() + static_cast<std::ptrdiff_t>(i);
+            channel.pushWait(first, first + 4);
+        }
+        for (; i < values.size(); ++i) { channel.pushWait(values[i]); }
+    });
+
+    producer.join();
+    consumer.join();
+
+    EXPECT_TRUE(channel.empty());
+}
+
 TEST(RingBufferTest, Alignment) {
     RingBuffer<int, 5> channel1;
     EXPECT_EQ(alignof(RingBuffer<int, 5>) % CACHE_LINE_SIZE, 0U);
@@ -320,3 +608,21 @@ TEST(RingBufferTest, Alignment) {
     EXPECT_EQ(alignof(RingBuffer<char, 125>) % CACHE_LINE_SIZE, 0U);
     EXPECT_EQ(sizeof(channel2) % CACHE_LINE_SIZE, 0U);
 }
+
+TEST(RingBufferTest, Footprint) {
+    constexpr auto numLines = [](const std::size_t numBytes) {
+        return (numBytes + CACHE_LINE_SIZE - 1U) / CACHE_LINE_SIZE;
+    };
+    EXPECT_EQ(sizeof(RingBuffer<int, 16>), (numLines(16U * sizeof(int)) + 2U) * CACHE_LINE_SIZE);
+    EXPECT_EQ(sizeof(RingBuffer<char, 125>), (numLines(125U) + 2U) * CACHE_LINE_SIZE);
+
+    using CompactRingBuffer = RingBuffer<int, 16, false, alignof(std::size_t)>;
+    EXPECT_EQ(alignof(CompactRingBuffer), alignof(std::size_t));
+    EXPECT_EQ(sizeof(CompactRingBuffer), 16U * sizeof(int) + 4U * sizeof(std::size_t));
+
+    CompactRingBuffer channel;
+    std::array<int, 6> values{1, 2, 3, 4, 5, 6};
+    EXPECT_TRUE(channel.push(values.cbegin(), values.cend()));
+    for (int val : values) { EXPECT_EQ(channel.pop().value(), val); }
+    EXPECT_TRUE(channel.empty());
+}
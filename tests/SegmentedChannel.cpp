@@ -0,0 +1,126 @@
+/*
+Copyright 2025 Raphael S. Steiner
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+@author Raphael S. Steiner
+*/
+
+#include "RingBuffer/SegmentedChannel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace spapq;
+
+TEST(SegmentedChannelTest, Functionality1) {
+    std::vector<int> values(23);
+    std::iota(values.begin(), values.end(), -4);
+
+    SegmentedChannel<int, 4> channel;
+    EXPECT_EQ(channel.segmentSize(), 4U);
+    EXPECT_TRUE(channel.empty());
+    EXPECT_FALSE(channel.pop());
+
+    for (std::size_t i = 0U; i < values.size(); ++i) {
+        EXPECT_TRUE(channel.push(values[i]));
+        EXPECT_EQ(channel.occupancy(), i + 1U);
+        EXPECT_FALSE(channel.full());
+    }
+    EXPECT_EQ(channel.numSegments(), 6U);
+
+    int val = 0;
+    for (std::size_t i = 0U; i < 10U; ++i) {
+        EXPECT_TRUE(channel.pop(val));
+        EXPECT_EQ(val, values[i]);
+    }
+    for (std::size_t i = 10U; i < values.size(); ++i) {
+        std::optional<int> result = channel.pop();
+        EXPECT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), values[i]);
+    }
+    EXPECT_FALSE(channel.pop(val));
+    EXPECT_TRUE(channel.empty());
+}
+
+TEST(SegmentedChannelTest, Recycling) {
+    constexpr std::size_t batch = 7U;
+
+    std::vector<int> values(batch * 100U);
+    std::iota(values.begin(), values.end(), 3);
+
+    SegmentedChannel<int, 5> channel;
+    std::vector<int> out;
+
+    for (auto it = values.cbegin(); it != values.cend();) {
+        auto endIt = std::next(it, batch);
+        EXPECT_TRUE(channel.push(it, endIt));
+        it = endIt;
+
+        if (channel.occupancy() > 2U * batch) { channel.pop(std::back_inserter(out), batch); }
+    }
+    channel.drain(std::back_inserter(out));
+
+    EXPECT_TRUE(channel.empty());
+    EXPECT_EQ(out, values);
+
+    // Memory is bounded by the backlog, not the total number of pushes
+    EXPECT_LE(channel.numSegments(), 6U);
+}
+
+TEST(SegmentedChannelTest, MoveOnly) {
+    SegmentedChannel<std::unique_ptr<int>, 2> channel;
+
+    std::unique_ptr<int> val = std::make_unique<int>(3);
+    EXPECT_TRUE(channel.push(std::move(val)));
+    EXPECT_EQ(val, nullptr);
+
+    std::array<std::unique_ptr<int>, 3U> batch{
+        std::make_unique<int>(5), std::make_unique<int>(7), std::make_unique<int>(9)};
+    EXPECT_TRUE(channel.push(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end())));
+
+    std::vector<std::unique_ptr<int>> out;
+    EXPECT_EQ(channel.drain(std::back_inserter(out)), 4U);
+    std::array<int, 4U> expected{3, 5, 7, 9};
+    for (std::size_t i = 0U; i < out.size(); ++i) { EXPECT_EQ(*out[i], expected[i]); }
+}
+
+TEST(SegmentedChannelTest, Multithread1) {
+    std::vector<std::size_t> values(1000000);
+    for (std::size_t i = 0U; i < values.size(); ++i) { values[i] = static_cast<std::size_t>(std::rand()); }
+
+    SegmentedChannel<std::size_t, 64> channel;
+
+    std::jthread consumer([&channel, &values]() {
+        std::vector<std::size_t> out;
+        out.reserve(values.size());
+        while (out.size() < values.size()) { channel.pop(std::back_inserter(out), 100U); }
+        EXPECT_EQ(out, values);
+    });
+
+    std::jthread producer([&channel, &values]() {
+        for (std::size_t i = 0U; i < values.size(); i += 10U) {
+            auto it = std::next(values.cbegin(), static_cast<std::ptrdiff_t>(i));
+            EXPECT_TRUE(channel.push(it, std::next(it, 10)));
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    EXPECT_TRUE(channel.empty());
+}
@@ -20,6 +20,16 @@ limitations under the License.
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "ParallelPriotityQueue/GraphExamples/FullyConnectedGraph.hpp"
@@ -46,7 +56,7 @@ class DivisorWorker final : public WorkerResource<GlobalQType, LocalQType, numPo
     std::vector<std::size_t> &locAnsCounter_;
 
   protected:
-    inline void processElement(const value_type val) noexcept override {
+    inline void processElement(value_type &&val) noexcept override {
         ++locAnsCounter_[val];
         for (value_type i = 2 * val; i < divisorTestMaxSize; i += val) { this->enqueueGlobal(i); }
     }
@@ -67,6 +77,45 @@ class DivisorWorker final : public WorkerResource<GlobalQType, LocalQType, numPo
     virtual ~DivisorWorker() = default;
 };
 
+/**
+ * @brief Divisor worker processing its tasks by value through ByValueWorkerResource.
+ *
+ */
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+class ByValueDivisorWorker final : public ByValueWorkerResource<GlobalQType, LocalQType, numPorts> {
+    template <typename, BasicQueue, std::size_t>
+    friend class ByValueDivisorWorker;
+    template <typename, QNetwork, template <class, BasicQueue, std::size_t> class, BasicQueue>
+    friend class SpapQueue;
+
+    using BaseT = ByValueWorkerResource<GlobalQType, LocalQType, numPorts>;
+    using value_type = BaseT::value_type;
+
+  private:
+    std::vector<std::size_t> &locAnsCounter_;
+
+  protected:
+    inline void processElement(const value_type val) noexcept override {
+        ++locAnsCounter_[val];
+        for (value_type i = 2 * val; i < divisorTestMaxSize; i += val) { this->enqueueGlobal(i); }
+    }
+
+  public:
+    template <std::size_t channelIndicesLength>
+    constexpr ByValueDivisorWorker(GlobalQType &globalQueue,
+                                   const std::array<std::size_t, channelIndicesLength> &channelIndices,
+                                   std::size_t workerId,
+                                   std::vector<std::vector<std::size_t>> &ansCounter) :
+        ByValueWorkerResource<GlobalQType, LocalQType, numPorts>(globalQueue, channelIndices, workerId),
+        locAnsCounter_(ansCounter[workerId]) {}
+
+    ByValueDivisorWorker(const ByValueDivisorWorker &other) = delete;
+    ByValueDivisorWorker(ByValueDivisorWorker &&other) = delete;
+    ByValueDivisorWorker &operator=(const ByValueDivisorWorker &other) = delete;
+    ByValueDivisorWorker &operator=(ByValueDivisorWorker &&other) = delete;
+    virtual ~ByValueDivisorWorker() = default;
+};
+
 std::vector<std::size_t> computeAnswerDivisors(std::size_t N) {
     std::vector<std::size_t> count(N, 1U);
     count[0U] = 0U;
@@ -83,6 +132,22 @@ std::vector<std::size_t> computeAnswerDivisors(std::size_t N) {
     return count;
 }
 
+/**
+ * @brief Tallies up the divisor counts of all workers into the first one and compares them to count many
+ * runs of the divisors test.
+ *
+ */
+void expectDivisorCounts(std::vector<std::vector<std::size_t>> &ansCounter, const std::size_t count = 1U) {
+    const std::vector<std::size_t> solution = computeAnswerDivisors(divisorTestMaxSize);
+
+    // Tallying up from all workers
+    for (std::size_t i = 1; i < ansCounter.size(); ++i) {
+        for (std::size_t j = 0; j < divisorTestMaxSize; ++j) { ansCounter[0][j] += ansCounter[i][j]; }
+    }
+
+    for (std::size_t i = 0; i < divisorTestMaxSize; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i] * count); }
+}
+
 using FibonacchiLocalQueueType
     = std::priority_queue<std::size_t, std::vector<std::size_t>, std::less<std::size_t>>;
 
@@ -102,7 +167,7 @@ class FibonacciWorker final : public WorkerResource<GlobalQType, LocalQType, num
     std::vector<std::size_t> &locAnsCounter_;
 
   protected:
-    inline void processElement(const value_type val) noexcept override {
+    inline void processElement(value_type &&val) noexcept override {
         ++locAnsCounter_[val];
 
         if (val > 0) { this->enqueueGlobal(val - 1); }
@@ -133,6 +198,430 @@ std::vector<std::size_t> computeAnswerFibonacci(std::size_t N) {
     return count;
 }
 
+struct PointeeLess {
+    inline bool operator()(const std::unique_ptr<std::size_t> &lhs,
+                           const std::unique_ptr<std::size_t> &rhs) const noexcept {
+        return *lhs < *rhs;
+    }
+};
+
+using MoveOnlyLocalQueueType
+    = std::priority_queue<std::unique_ptr<std::size_t>, std::vector<std::unique_ptr<std::size_t>>, PointeeLess>;
+
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+class MoveOnlyFibonacciWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts> {
+    template <typename, BasicQueue, std::size_t>
+    friend class MoveOnlyFibonacciWorker;
+    template <typename, QNetwork, template <class, BasicQueue, std::size_t> class, BasicQueue>
+    friend class SpapQueue;
+
+    using BaseT = WorkerResource<GlobalQType, LocalQType, numPorts>;
+    using value_type = BaseT::value_type;
+
+  private:
+    std::vector<std::size_t> &locAnsCounter_;
+
+  protected:
+    inline void processElement(value_type &&val) noexcept override {
+        ++locAnsCounter_[*val];
+
+        if (*val > 0) { this->enqueueGlobal(std::make_unique<std::size_t>(*val - 1)); }
+        if (*val > 1) {
+            std::unique_ptr<std::size_t> task = std::make_unique<std::size_t>(*val - 2);
+            this->enqueueGlobal(std::move(task));
+        }
+    }
+
+  public:
+    template <std::size_t channelIndicesLength>
+    constexpr MoveOnlyFibonacciWorker(GlobalQType &globalQueue,
+                                      const std::array<std::size_t, channelIndicesLength> &channelIndices,
+                                      std::size_t workerId,
+                                      std::vector<std::vector<std::size_t>> &ansCounter) :
+        WorkerResource<GlobalQType, LocalQType, numPorts>(globalQueue, channelIndices, workerId),
+        locAnsCounter_(ansCounter[workerId]){}
+
+    MoveOnlyFibonacciWorker(const MoveOnlyFibonacciWorker &other) = delete;
+    MoveOnlyFibonacciWorker(MoveOnlyFibonacciWorker &&other) = delete;
+    MoveOnlyFibonacciWorker &operator=(const MoveOnlyFibonacciWorker &other) = delete;
+    MoveOnlyFibonacciWorker &operator=(MoveOnlyFibonacciWorker &&other) = delete;
+    virtual ~MoveOnlyFibonacciWorker() = default;
+};
+
+/**
+ * @brief A chain of divisors 1 = d_0 | d_1 | ... | d_k, whose serialised size grows with its length.
+ *
+ */
+struct DivisorChain {
+    std::vector<std::size_t> chain_;
+
+    inline std::size_t serialisedSize() const noexcept { return chain_.size() * sizeof(std::size_t); }
+
+    inline void serialise(std::span<std::byte> out) const noexcept {
+        std::memcpy(out.data(), chain_.data(), out.size());
+    }
+
+    static inline DivisorChain deserialise(std::span<const std::byte> in) noexcept {
+        DivisorChain task;
+        task.chain_.resize(in.size() / sizeof(std::size_t));
+        std::memcpy(task.chain_.data(), in.data(), in.size());
+        return task;
+    }
+};
+
+struct DivisorChainGreater {
+    inline bool operator()(const DivisorChain &lhs, const DivisorChain &rhs) const noexcept {
+        return lhs.chain_.back() > rhs.chain_.back();
+    }
+};
+
+using DivisorChainLocalQueueType
+    = std::priority_queue<DivisorChain, std::vector<DivisorChain>, DivisorChainGreater>;
+
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+class DivisorChainWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts> {
+    template <typename, BasicQueue, std::size_t>
+    friend class DivisorChainWorker;
+    template <typename, QNetwork, template <class, BasicQueue, std::size_t> class, BasicQueue>
+    friend class SpapQueue;
+
+    using BaseT = WorkerResource<GlobalQType, LocalQType, numPorts>;
+    using value_type = BaseT::value_type;
+
+  private:
+    std::vector<std::size_t> &locAnsCounter_;
+
+  protected:
+    inline void processElement(value_type &&val) noexcept override {
+        const std::size_t last = val.chain_.back();
+        for (std::size_t i = 1U; i < val.chain_.size(); ++i) {
+            if (val.chain_[i] % val.chain_[i - 1U] != 0U) { return; }
+        }
+        ++locAnsCounter_[last];
+
+        for (std::size_t i = 2 * last; i < divisorTestMaxSize; i += last) {
+            DivisorChain task{val.chain_};
+            task.chain_.emplace_back(i);
+            this->enqueueGlobal(std::move(task));
+        }
+    }
+
+  public:
+    template <std::size_t channelIndicesLength>
+    constexpr DivisorChainWorker(GlobalQType &globalQueue,
+                                 const std::array<std::size_t, channelIndicesLength> &channelIndices,
+                                 std::size_t workerId,
+                                 std::vector<std::vector<std::size_t>> &ansCounter) :
+        WorkerResource<GlobalQType, LocalQType, numPorts>(globalQueue, channelIndices, workerId),
+        locAnsCounter_(ansCounter[workerId]){}
+
+    DivisorChainWorker(const DivisorChainWorker &other) = delete;
+    DivisorChainWorker(DivisorChainWorker &&other) = delete;
+    DivisorChainWorker &operator=(const DivisorChainWorker &other) = delete;
+    DivisorChainWorker &operator=(DivisorChainWorker &&other) = delete;
+    virtual ~DivisorChainWorker() = default;
+};
+
+constexpr std::size_t broadcastTestPeriod = 64U;
+
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+class BroadcastDivisorWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts> {
+    template <typename, BasicQueue, std::size_t>
+    friend class BroadcastDivisorWorker;
+    template <typename, QNetwork, template <class, BasicQueue, std::size_t> class, BasicQueue>
+    friend class SpapQueue;
+
+    using BaseT = WorkerResource<GlobalQType, LocalQType, numPorts>;
+    using value_type = BaseT::value_type;
+    using broadcast_type = BaseT::broadcast_type;
+
+  private:
+    std::vector<std::size_t> &locAnsCounter_;
+    std::vector<std::size_t> &locReceived_;
+
+  protected:
+    inline void processElement(value_type &&val) noexcept override {
+        ++locAnsCounter_[val];
+        if (val % broadcastTestPeriod == 0U) { this->broadcast(val); }
+        for (value_type i = 2 * val; i < divisorTestMaxSize; i += val) { this->enqueueGlobal(i); }
+    }
+
+    inline void processBroadcast(const broadcast_type val) noexcept override {
+        locReceived_.emplace_back(val);
+    }
+
+  public:
+    template <std::size_t channelIndicesLength>
+    constexpr BroadcastDivisorWorker(GlobalQType &globalQueue,
+                                     const std::array<std::size_t, channelIndicesLength> &channelIndices,
+                                     std::size_t workerId,
+                                     std::vector<std::vector<std::size_t>> &ansCounter,
+                                     std::vector<std::vector<std::size_t>> &received) :
+        WorkerResource<GlobalQType, LocalQType, numPorts>(globalQueue, channelIndices, workerId),
+        locAnsCounter_(ansCounter[workerId]),
+        locReceived_(received[workerId]){}
+
+    BroadcastDivisorWorker(const BroadcastDivisorWorker &other) = delete;
+    BroadcastDivisorWorker(BroadcastDivisorWorker &&other) = delete;
+    BroadcastDivisorWorker &operator=(const BroadcastDivisorWorker &other) = delete;
+    BroadcastDivisorWorker &operator=(BroadcastDivisorWorker &&other) = delete;
+    virtual ~BroadcastDivisorWorker() = default;
+};
+
+constexpr std::size_t processBatchTestWidth = 4U;
+
+struct BulkDivisorLocalQueueType : public DivisorLocalQueueType {
+    std::size_t extractTop(std::size_t *out, const std::size_t maxCount) {
+        std::size_t numElements = 0U;
+        for (; numElements < maxCount && (not empty()); ++numElements) {
+            out[numElements] = top();
+            pop();
+        }
+        return numElements;
+    }
+};
+
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+class BatchDivisorWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts> {
+    template <typename, BasicQueue, std::size_t>
+    friend class BatchDivisorWorker;
+    template <typename, QNetwork, template <class, BasicQueue, std::size_t> class, BasicQueue>
+    friend class SpapQueue;
+
+    using BaseT = WorkerResource<GlobalQType, LocalQType, numPorts>;
+    using value_type = BaseT::value_type;
+
+  private:
+    std::vector<std::size_t> &locAnsCounter_;
+    std::size_t &locMaxBatch_;
+    std::size_t &locUnsortedBatches_;
+
+  protected:
+    inline void processElement(value_type &&val) noexcept override {
+        ++locAnsCounter_[val];
+        for (value_type i = 2 * val; i < divisorTestMaxSize; i += val) { this->enqueueGlobal(i); }
+    }
+
+    inline void processBatch(std::span<value_type> vals) noexcept override {
+        locMaxBatch_ = std::max(locMaxBatch_, vals.size());
+        if (not std::is_sorted(vals.begin(), vals.end())) { ++locUnsortedBatches_; }
+        for (value_type &val : vals) { processElement(std::move(val)); }
+    }
+
+  public:
+    template <std::size_t channelIndicesLength>
+    constexpr BatchDivisorWorker(GlobalQType &globalQueue,
+                                 const std::array<std::size_t, channelIndicesLength> &channelIndices,
+                                 std::size_t workerId,
+                                 std::vector<std::vector<std::size_t>> &ansCounter,
+                                 std::vector<std::size_t> &maxBatch,
+                                 std::vector<std::size_t> &unsortedBatches) :
+        WorkerResource<GlobalQType, LocalQType, numPorts>(globalQueue, channelIndices, workerId),
+        locAnsCounter_(ansCounter[workerId]),
+        locMaxBatch_(maxBatch[workerId]),
+        locUnsortedBatches_(unsortedBatches[workerId]){}
+
+    BatchDivisorWorker(const BatchDivisorWorker &other) = delete;
+    BatchDivisorWorker(BatchDivisorWorker &&other) = delete;
+    BatchDivisorWorker &operator=(const BatchDivisorWorker &other) = delete;
+    BatchDivisorWorker &operator=(BatchDivisorWorker &&other) = delete;
+    virtual ~BatchDivisorWorker() = default;
+};
+
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+class RangeDivisorWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts> {
+    template <typename, BasicQueue, std::size_t>
+    friend class RangeDivisorWorker;
+    template <typename, QNetwork, template <class, BasicQueue, std::size_t> class, BasicQueue>
+    friend class SpapQueue;
+
+    using BaseT = WorkerResource<GlobalQType, LocalQType, numPorts>;
+    using value_type = BaseT::value_type;
+
+  private:
+    std::vector<std::size_t> &locAnsCounter_;
+    std::vector<value_type> children_;
+
+  protected:
+    inline void processElement(value_type &&val) noexcept override {
+        ++locAnsCounter_[val];
+        children_.clear();
+        for (value_type i = 2 * val; i < divisorTestMaxSize; i += val) { children_.emplace_back(i); }
+        this->enqueueGlobal(children_.cbegin(), children_.cend());
+    }
+
+  public:
+    template <std::size_t channelIndicesLength>
+    RangeDivisorWorker(GlobalQType &globalQueue,
+                       const std::array<std::size_t, channelIndicesLength> &channelIndices,
+                       std::size_t workerId,
+                       std::vector<std::vector<std::size_t>> &ansCounter) :
+        WorkerResource<GlobalQType, LocalQType, numPorts>(globalQueue, channelIndices, workerId),
+        locAnsCounter_(ansCounter[workerId]) {
+        children_.reserve(divisorTestMaxSize / 2U);
+    }
+
+    RangeDivisorWorker(const RangeDivisorWorker &other) = delete;
+    RangeDivisorWorker(RangeDivisorWorker &&other) = delete;
+    RangeDivisorWorker &operator=(const RangeDivisorWorker &other) = delete;
+    RangeDivisorWorker &operator=(RangeDivisorWorker &&other) = delete;
+    virtual ~RangeDivisorWorker() = default;
+};
+
+constexpr std::size_t chainTestLength = 4096U;
+
+struct CountingChainLocalQueueType : public std::priority_queue<std::size_t> {
+    std::size_t *numPushes_;
+
+    explicit CountingChainLocalQueueType(std::size_t &numPushes) : numPushes_(&numPushes) {}
+
+    void push(const std::size_t &val) {
+        ++(*numPushes_);
+        std::priority_queue<std::size_t>::push(val);
+    }
+};
+
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+class ChainWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts> {
+    template <typename, BasicQueue, std::size_t>
+    friend class ChainWorker;
+    template <typename, QNetwork, template <class, BasicQueue, std::size_t> class, BasicQueue>
+    friend class SpapQueue;
+
+    using BaseT = WorkerResource<GlobalQType, LocalQType, numPorts>;
+    using value_type = BaseT::value_type;
+
+  private:
+    std::size_t &locNumProcessed_;
+
+  protected:
+    inline void processElement(value_type &&val) noexcept override {
+        ++locNumProcessed_;
+        if (val + 1U < chainTestLength) { this->enqueueGlobal(val + 1U); }
+    }
+
+  public:
+    template <std::size_t channelIndicesLength>
+    constexpr ChainWorker(GlobalQType &globalQueue,
+                          const std::array<std::size_t, channelIndicesLength> &channelIndices,
+                          std::size_t workerId,
+                          std::vector<std::size_t> &numProcessed,
+                          std::vector<std::size_t> &numPushes) :
+        WorkerResource<GlobalQType, LocalQType, numPorts>(
+            globalQueue, channelIndices, workerId, numPushes[workerId]),
+        locNumProcessed_(numProcessed[workerId]){}
+
+    ChainWorker(const ChainWorker &other) = delete;
+    ChainWorker(ChainWorker &&other) = delete;
+    ChainWorker &operator=(const ChainWorker &other) = delete;
+    ChainWorker &operator=(ChainWorker &&other) = delete;
+    virtual ~ChainWorker() = default;
+};
+
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+class BlockingWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts> {
+    template <typename, BasicQueue, std::size_t>
+    friend class BlockingWorker;
+    template <typename, QNetwork, template <class, BasicQueue, std::size_t> class, BasicQueue>
+    friend class SpapQueue;
+
+    using BaseT = WorkerResource<GlobalQType, LocalQType, numPorts>;
+    using value_type = BaseT::value_type;
+
+  private:
+    const std::atomic<bool> &release_;
+
+  protected:
+    inline void processElement([[maybe_unused]] value_type &&val) noexcept override {
+        while (not release_.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+    }
+
+  public:
+    template <std::size_t channelIndicesLength>
+    constexpr BlockingWorker(GlobalQType &globalQueue,
+                             const std::array<std::size_t, channelIndicesLength> &channelIndices,
+                             std::size_t workerId,
+                             const std::atomic<bool> &release) :
+        WorkerResource<GlobalQType, LocalQType, numPorts>(globalQueue, channelIndices, workerId),
+        release_(release){}
+
+    BlockingWorker(const BlockingWorker &other) = delete;
+    BlockingWorker(BlockingWorker &&other) = delete;
+    BlockingWorker &operator=(const BlockingWorker &other) = delete;
+    BlockingWorker &operator=(BlockingWorker &&other) = delete;
+    virtual ~BlockingWorker() = default;
+};
+
+constexpr std::size_t drainQuotaTestFlood = 40U;
+constexpr std::size_t drainQuotaTestGate = drainQuotaTestFlood + 1U;
+constexpr std::size_t drainQuotaTestQuota = 4U;
+
+struct DrainCountingLocalQueueType : public DivisorLocalQueueType {
+    bool popped_{false};        ///< Pushes before the first pop include the initial task.
+    std::size_t pushesSincePop_{0U};
+    std::size_t *maxPushesBetweenPops_;
+
+    explicit DrainCountingLocalQueueType(std::size_t &maxPushesBetweenPops) :
+        maxPushesBetweenPops_(&maxPushesBetweenPops) { }
+
+    void push(const std::size_t &val) {
+        ++pushesSincePop_;
+        if (popped_) { *maxPushesBetweenPops_ = std::max(*maxPushesBetweenPops_, pushesSincePop_); }
+        DivisorLocalQueueType::push(val);
+    }
+
+    void pop() {
+        popped_ = true;
+        pushesSincePop_ = 0U;
+        DivisorLocalQueueType::pop();
+    }
+};
+
+template <typename GlobalQType, BasicQueue LocalQType, std::size_t numPorts>
+class FloodWorker final : public WorkerResource<GlobalQType, LocalQType, numPorts> {
+    template <typename, BasicQueue, std::size_t>
+    friend class FloodWorker;
+    template <typename, QNetwork, template <class, BasicQueue, std::size_t> class, BasicQueue>
+    friend class SpapQueue;
+
+    using BaseT = WorkerResource<GlobalQType, LocalQType, numPorts>;
+    using value_type = BaseT::value_type;
+
+  private:
+    std::size_t &locNumProcessed_;
+    std::atomic<bool> &flooded_;
+
+  protected:
+    inline void processElement(value_type &&val) noexcept override {
+        ++locNumProcessed_;
+        if (val == 0U) {
+            for (value_type i = 1U; i <= drainQuotaTestFlood; ++i) { this->enqueueGlobal(i); }
+            flooded_.store(true, std::memory_order_release);
+        } else if (val == drainQuotaTestGate) {
+            while (not flooded_.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+        }
+    }
+
+  public:
+    template <std::size_t channelIndicesLength>
+    constexpr FloodWorker(GlobalQType &globalQueue,
+                          const std::array<std::size_t, channelIndicesLength> &channelIndices,
+                          std::size_t workerId,
+                          std::vector<std::size_t> &numProcessed,
+                          std::vector<std::size_t> &maxPushesBetweenPops,
+                          std::atomic<bool> &flooded) :
+        WorkerResource<GlobalQType, LocalQType, numPorts>(
+            globalQueue, channelIndices, workerId, maxPushesBetweenPops[workerId]),
+        locNumProcessed_(numProcessed[workerId]),
+        flooded_(flooded){}
+
+    FloodWorker(const FloodWorker &other) = delete;
+    FloodWorker(FloodWorker &&other) = delete;
+    FloodWorker &operator=(const FloodWorker &other) = delete;
+    FloodWorker &operator=(FloodWorker &&other) = delete;
+    virtual ~FloodWorker() = default;
+};
+
 constexpr unsigned SSSPTorusSideLength = 80U;
 
 CSRGraph make3DTorus(const unsigned sideLength) {
@@ -166,149 +655,656 @@ CSRGraph make3DTorus(const unsigned sideLength) {
     graph.sourcePointers_.emplace_back(graph.edgeTargets_.size());
 
     return graph;
-}
+}
+
+TEST(SpapQueueTest, Constructors1) {
+    constexpr QNetwork<1, 1> netw = FULLY_CONNECTED_GRAPH<1U>();
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+}
+
+TEST(SpapQueueTest, Constructors2) {
+    constexpr QNetwork<4, 16> netw = FULLY_CONNECTED_GRAPH<4U>();
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+}
+
+TEST(SpapQueueTest, Constructors3) {
+    constexpr QNetwork<2, 3> netw({0, 1, 3}, {1, 0, 1});
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+}
+
+TEST(SpapQueueTest, EmptyQueue1) {
+    constexpr QNetwork<1, 1> netw = FULLY_CONNECTED_GRAPH<1U>();
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    EXPECT_FALSE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+}
+
+TEST(SpapQueueTest, EmptyQueue2) {
+    constexpr QNetwork<4, 16> netw = FULLY_CONNECTED_GRAPH<4U>();
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    EXPECT_FALSE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+}
+
+TEST(SpapQueueTest, EmptyQueue3) {
+    constexpr QNetwork<2, 3> netw({0, 1, 3}, {1, 0, 1});
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    EXPECT_FALSE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+}
+
+TEST(SpapQueueTest, Destructor1) {
+    constexpr QNetwork<4, 16> netw = FULLY_CONNECTED_GRAPH<4U>();
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+}
+
+TEST(SpapQueueTest, Destructor2) {
+    constexpr QNetwork<2, 3> netw({0, 1, 3}, {1, 0, 1});
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+}
+
+TEST(SpapQueueTest, DivisorsSingleWorker) {
+    constexpr QNetwork<1, 1> netw = FULLY_CONNECTED_GRAPH<1U>();
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    std::vector<std::size_t> solution = computeAnswerDivisors(divisorTestMaxSize);
+
+    // Tallying up from all workers
+    for (std::size_t i = 1; i < netw.numWorkers_; ++i) {
+        for (std::size_t j = 0; j < divisorTestMaxSize; ++j) { ansCounter[0][j] += ansCounter[i][j]; }
+    }
+
+    for (std::size_t i = 0; i < divisorTestMaxSize; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i]); }
+}
+
+TEST(SpapQueueTest, DivisorsHomogeneousWorkers) {
+    constexpr QNetwork<4, 16> netw = FULLY_CONNECTED_GRAPH<4U>();
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    std::vector<std::size_t> solution = computeAnswerDivisors(divisorTestMaxSize);
+
+    // Tallying up from all workers
+    for (std::size_t i = 1; i < netw.numWorkers_; ++i) {
+        for (std::size_t j = 0; j < divisorTestMaxSize; ++j) { ansCounter[0][j] += ansCounter[i][j]; }
+    }
+
+    for (std::size_t i = 0; i < divisorTestMaxSize; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i]); }
+}
+
+TEST(SpapQueueTest, DivisorsHeterogeneousWorkers) {
+    constexpr QNetwork<2, 3> netw({0, 1, 3}, {1, 0, 1});
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    std::vector<std::size_t> solution = computeAnswerDivisors(divisorTestMaxSize);
+
+    // Tallying up from all workers
+    for (std::size_t i = 1; i < netw.numWorkers_; ++i) {
+        for (std::size_t j = 0; j < divisorTestMaxSize; ++j) { ansCounter[0][j] += ansCounter[i][j]; }
+    }
+
+    for (std::size_t i = 0; i < divisorTestMaxSize; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i]); }
+}
+
+/**
+ * @brief A configuration of the divisors test: the network, the worker and the self-push channels into which
+ * additional starting tasks are pushed during processing.
+ *
+ */
+template <QNetwork network,
+          template <class, BasicQueue, std::size_t> class WorkerTemplate = DivisorWorker,
+          std::size_t... pushChannels>
+struct DivisorsConfig {
+    static constexpr auto netw = network;
+    using QueueType = SpapQueue<std::size_t, network, WorkerTemplate, DivisorLocalQueueType>;
+
+    static std::size_t pushDuringProcessing([[maybe_unused]] QueueType &globalQ) {
+        return (std::size_t{0U} + ... + (globalQ.template pushDuringProcessing<pushChannels>(1U) ? 1U : 0U));
+    }
+};
+
+constexpr QNetwork<4, 16> mergedPortsNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.mergeInPorts();
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> segmentedChannelsNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.channelKind_ = ChannelKind::SPSCSegmented;
+    graph.channelBufferSize_ = 8U;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> doorbellsNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.portDoorbells_ = true;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> widePaddingNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.falseSharingPadding_ = 2U * CACHE_LINE_SIZE;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> widePaddingMergedPortsNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.mergeInPorts();
+    graph.channelKind_ = ChannelKind::MPSCRing;
+    graph.portDoorbells_ = true;
+    graph.falseSharingPadding_ = 2U * CACHE_LINE_SIZE;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> narrowPaddingSegmentedNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.channelKind_ = ChannelKind::SPSCSegmented;
+    graph.channelBufferSize_ = 8U;
+    graph.falseSharingPadding_ = alignof(std::size_t);
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> boundedDrainingNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.setDrainQuotasFromMultiplicities();
+    graph.drainBudget_ = 8U;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> boundedDrainingDoorbellsNetw = []() {
+    QNetwork<4, 16> graph = boundedDrainingNetw;
+    graph.portDoorbells_ = true;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> defaultProcessBatchNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.processBatchSize_ = 16U;
+    return graph;
+}();
+
+constexpr QNetwork<2, 3> streamingPushesNetw = []() {
+    QNetwork<2, 3> graph({0, 1, 3}, {1, 0, 1});
+    graph.streamingPushes_ = true;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> continuationsNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.continuations_ = true;
+    return graph;
+}();
+
+constexpr QNetwork<2, 3> continuationsProcessBatchNetw = []() {
+    QNetwork<2, 3> graph({0, 1, 3}, {1, 0, 1});
+    graph.continuations_ = true;
+    graph.processBatchSize_ = 4U;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> idleBackoffNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.idlePolicy_ = IdlePolicy::Backoff;
+    return graph;
+}();
+
+constexpr QNetwork<2, 3> idleYieldNetw = []() {
+    QNetwork<2, 3> graph({0, 1, 3}, {1, 0, 1});
+    graph.idlePolicy_ = IdlePolicy::Yield;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> idleParkNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.idlePolicy_ = IdlePolicy::Park;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> idleParkDoorbellsNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.idlePolicy_ = IdlePolicy::Park;
+    graph.portDoorbells_ = true;
+    graph.drainQuota_.fill(8U);
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> quiescenceNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.termination_ = TerminationDetection::Quiescence;
+    return graph;
+}();
+
+constexpr QNetwork<2, 3> quiescenceIdleParkNetw = []() {
+    QNetwork<2, 3> graph({0, 1, 3}, {1, 0, 1});
+    graph.termination_ = TerminationDetection::Quiescence;
+    graph.idlePolicy_ = IdlePolicy::Park;
+    return graph;
+}();
+
+constexpr QNetwork<4, 16> persistentWorkersNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.persistentWorkers_ = true;
+    return graph;
+}();
 
-TEST(SpapQueueTest, Constructors1) {
-    constexpr QNetwork<1, 1> netw = FULLY_CONNECTED_GRAPH<1U>();
+constexpr QNetwork<4, 16> staticDispatchNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.staticDispatch_ = true;
+    return graph;
+}();
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
-}
+constexpr QNetwork<4, 16> staticDispatchProcessBatchNetw = []() {
+    QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+    graph.processBatchSize_ = 16U;
+    graph.staticDispatch_ = true;
+    return graph;
+}();
+
+using DivisorsConfigs = ::testing::Types<DivisorsConfig<mergedPortsNetw, DivisorWorker, 0U, 4U>,
+                                         DivisorsConfig<segmentedChannelsNetw>,
+                                         DivisorsConfig<doorbellsNetw, DivisorWorker, 0U, 8U>,
+                                         DivisorsConfig<widePaddingNetw, DivisorWorker, 0U, 8U>,
+                                         DivisorsConfig<widePaddingMergedPortsNetw, DivisorWorker, 0U, 4U>,
+                                         DivisorsConfig<narrowPaddingSegmentedNetw>,
+                                         DivisorsConfig<boundedDrainingNetw, DivisorWorker, 0U, 8U>,
+                                         DivisorsConfig<boundedDrainingDoorbellsNetw, DivisorWorker, 0U, 8U>,
+                                         DivisorsConfig<defaultProcessBatchNetw>,
+                                         DivisorsConfig<FULLY_CONNECTED_GRAPH<4U>(), RangeDivisorWorker>,
+                                         DivisorsConfig<streamingPushesNetw, RangeDivisorWorker>,
+                                         DivisorsConfig<continuationsNetw>,
+                                         DivisorsConfig<continuationsProcessBatchNetw, RangeDivisorWorker>,
+                                         DivisorsConfig<idleBackoffNetw>,
+                                         DivisorsConfig<idleYieldNetw>,
+                                         DivisorsConfig<idleParkNetw>,
+                                         DivisorsConfig<idleParkDoorbellsNetw, DivisorWorker, 0U, 8U>,
+                                         DivisorsConfig<quiescenceNetw, DivisorWorker, 0U, 4U, 8U, 12U>,
+                                         DivisorsConfig<quiescenceIdleParkNetw>,
+                                         DivisorsConfig<persistentWorkersNetw, DivisorWorker, 0U, 8U>,
+                                         DivisorsConfig<staticDispatchNetw>,
+                                         DivisorsConfig<staticDispatchNetw, ByValueDivisorWorker>,
+                                         DivisorsConfig<staticDispatchProcessBatchNetw>>;
+
+template <typename Config>
+class SpapQueueDivisorsTest : public ::testing::Test { };
+
+TYPED_TEST_SUITE(SpapQueueDivisorsTest, DivisorsConfigs);
+
+TYPED_TEST(SpapQueueDivisorsTest, Divisors) {
+    constexpr auto netw = TypeParam::netw;
 
-TEST(SpapQueueTest, Constructors2) {
-    constexpr QNetwork<4, 16> netw = FULLY_CONNECTED_GRAPH<4U>();
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
-}
+    typename TypeParam::QueueType globalQ;
 
-TEST(SpapQueueTest, Constructors3) {
-    constexpr QNetwork<2, 3> netw({0, 1, 3}, {1, 0, 1});
+    // The second run restarts the same queue from another worker
+    for (const std::size_t startWorker : {std::size_t{0U}, netw.numWorkers_ - 1U}) {
+        for (auto &vec : ansCounter) { std::fill(vec.begin(), vec.end(), 0U); }
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
-}
+        EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+        globalQ.pushBeforeProcessing(1U, startWorker);
+        globalQ.processQueue();
 
-TEST(SpapQueueTest, EmptyQueue1) {
-    constexpr QNetwork<1, 1> netw = FULLY_CONNECTED_GRAPH<1U>();
+        const std::size_t count = 1U + TypeParam::pushDuringProcessing(globalQ);
 
-    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
-                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+        globalQ.waitProcessFinish();
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
-    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
-    EXPECT_FALSE(globalQ.initQueue(std::ref(ansCounter)));
+        EXPECT_EQ(TypeParam::pushDuringProcessing(globalQ), 0U);
+        expectDivisorCounts(ansCounter, count);
+    }
+}
+
+TEST(SpapQueueTest, DrainQuota) {
+    constexpr QNetwork<2, 2> netw = []() {
+        QNetwork<2, 2> graph({0, 1, 2}, {1, 0});
+        graph.drainQuota_[0U] = drainQuotaTestQuota;
+        graph.enqueueFrequency_ = std::size_t{1U} << 20U;
+        return graph;
+    }();
+    static_assert(netw.channelBufferSize_ > drainQuotaTestFlood);
+
+    std::vector<std::size_t> numProcessed(netw.numWorkers_, 0U);
+    std::vector<std::size_t> maxPushesBetweenPops(netw.numWorkers_, 0U);
+    std::atomic<bool> flooded{false};
+
+    SpapQueue<std::size_t, netw, FloodWorker, DrainCountingLocalQueueType> globalQ;
+    EXPECT_TRUE(
+        globalQ.initQueue(std::ref(numProcessed), std::ref(maxPushesBetweenPops), std::ref(flooded)));
+    // Worker 0 floods the port of worker 1, which is held up by the gate until the port holds all tasks
+    globalQ.pushBeforeProcessing(0U, 0U);
+    globalQ.pushBeforeProcessing(drainQuotaTestGate, 1U);
     globalQ.processQueue();
     globalQ.waitProcessFinish();
+
+    EXPECT_EQ(numProcessed[0U], 1U);
+    EXPECT_EQ(numProcessed[1U], drainQuotaTestFlood + 1U);
+    // Each check of the port takes exactly the quota whilst the port holds more
+    EXPECT_EQ(maxPushesBetweenPops[1U], drainQuotaTestQuota);
 }
 
-TEST(SpapQueueTest, EmptyQueue2) {
-    constexpr QNetwork<4, 16> netw = FULLY_CONNECTED_GRAPH<4U>();
+TEST(SpapQueueTest, ChannelPadding) {
+    constexpr std::size_t padding = 2U * CACHE_LINE_SIZE;
+    constexpr auto paddedNetw = [](const ChannelKind kind) {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.channelKind_ = kind;
+        graph.falseSharingPadding_ = padding;
+        return graph;
+    };
+
+    // Every kind of channel follows the padding of the network
+    EXPECT_EQ(alignof(QNetworkChannel<std::size_t, paddedNetw(ChannelKind::SPSCRing)>), padding);
+    EXPECT_EQ(alignof(QNetworkChannel<std::size_t, paddedNetw(ChannelKind::MPSCRing)>), padding);
+    EXPECT_EQ(alignof(QNetworkChannel<std::size_t, paddedNetw(ChannelKind::SPSCSegmented)>), padding);
+    EXPECT_EQ(alignof(QNetworkChannel<DivisorChain, paddedNetw(ChannelKind::SPSCRecord)>), padding);
+
+    EXPECT_EQ(alignof(BroadcastChannel<std::size_t, 16U, padding>), padding);
+    EXPECT_EQ(alignof(Doorbell<4U, padding>), padding);
+    EXPECT_EQ(sizeof(Doorbell<4U, alignof(std::uint64_t)>), sizeof(std::uint64_t));
+}
+
+TEST(SpapQueueTest, DivisorsRecordChannels) {
+    constexpr QNetwork<4, 16> netw = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.channelKind_ = ChannelKind::SPSCRecord;
+        graph.channelBufferSize_ = 2048U;
+        return graph;
+    }();
 
     std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
                                                      std::vector<std::size_t>(divisorTestMaxSize, 0));
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    SpapQueue<DivisorChain, netw, DivisorChainWorker, DivisorChainLocalQueueType> globalQ;
     EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
-    EXPECT_FALSE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(DivisorChain{{1U}}, 0U);
     globalQ.processQueue();
     globalQ.waitProcessFinish();
+
+    expectDivisorCounts(ansCounter);
 }
 
-TEST(SpapQueueTest, EmptyQueue3) {
-    constexpr QNetwork<2, 3> netw({0, 1, 3}, {1, 0, 1});
+TEST(SpapQueueTest, DivisorsBroadcast) {
+    constexpr QNetwork<4, 16> netw = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.broadcastBufferSize_ = 16U;
+        return graph;
+    }();
 
     std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
                                                      std::vector<std::size_t>(divisorTestMaxSize, 0));
+    std::vector<std::vector<std::size_t>> received(netw.numWorkers_);
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
-    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
-    EXPECT_FALSE(globalQ.initQueue(std::ref(ansCounter)));
+    SpapQueue<std::size_t, netw, BroadcastDivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter), std::ref(received)));
+    globalQ.pushBeforeProcessing(1U, 0U);
     globalQ.processQueue();
     globalQ.waitProcessFinish();
+
+    expectDivisorCounts(ansCounter);
+
+    const std::vector<std::size_t> solution = computeAnswerDivisors(divisorTestMaxSize);
+
+    std::size_t numBroadcasts = 0U;
+    for (std::size_t i = broadcastTestPeriod; i < divisorTestMaxSize; i += broadcastTestPeriod) {
+        numBroadcasts += solution[i];
+    }
+
+    for (const auto &workerReceived : received) {
+        EXPECT_LE(workerReceived.size(), numBroadcasts);
+        for (const std::size_t val : workerReceived) {
+            EXPECT_EQ(val % broadcastTestPeriod, 0U);
+            EXPECT_LT(val, divisorTestMaxSize);
+        }
+    }
 }
 
-TEST(SpapQueueTest, Destructor1) {
-    constexpr QNetwork<4, 16> netw = FULLY_CONNECTED_GRAPH<4U>();
+TEST(SpapQueueTest, BroadcastMessage) {
+    EXPECT_TRUE((std::is_same_v<BroadcastMessage<std::size_t>::type, std::size_t>));
+    EXPECT_TRUE((std::is_same_v<BroadcastMessage<double>::type, double>));
+    EXPECT_TRUE((std::is_same_v<BroadcastMessage<std::unique_ptr<std::size_t>>::type, std::size_t>));
+    EXPECT_TRUE((std::is_same_v<BroadcastMessage<DivisorChain>::type, std::size_t>));
+}
+
+TEST(SpapQueueTest, DivisorsProcessBatch) {
+    constexpr QNetwork<4, 16> netw = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.processBatchSize_ = processBatchTestWidth;
+        return graph;
+    }();
 
     std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
                                                      std::vector<std::size_t>(divisorTestMaxSize, 0));
+    std::vector<std::size_t> maxBatch(netw.numWorkers_, 0U);
+    std::vector<std::size_t> unsortedBatches(netw.numWorkers_, 0U);
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
-    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    SpapQueue<std::size_t, netw, BatchDivisorWorker, BulkDivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter), std::ref(maxBatch), std::ref(unsortedBatches)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    expectDivisorCounts(ansCounter);
+
+    // Batches are best first and never wider than the configured width
+    for (const std::size_t workerMaxBatch : maxBatch) { EXPECT_LE(workerMaxBatch, processBatchTestWidth); }
+    for (const std::size_t workerUnsorted : unsortedBatches) { EXPECT_EQ(workerUnsorted, 0U); }
 }
 
-TEST(SpapQueueTest, Destructor2) {
-    constexpr QNetwork<2, 3> netw({0, 1, 3}, {1, 0, 1});
+TEST(SpapQueueTest, DivisorsByValueWorker) {
+    constexpr QNetwork<4, 16> netw = FULLY_CONNECTED_GRAPH<4U>();
 
     std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
                                                      std::vector<std::size_t>(divisorTestMaxSize, 0));
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    SpapQueue<std::size_t, netw, ByValueDivisorWorker, DivisorLocalQueueType> globalQ;
     EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    expectDivisorCounts(ansCounter);
 }
 
-TEST(SpapQueueTest, DivisorsSingleWorker) {
-    constexpr QNetwork<1, 1> netw = FULLY_CONNECTED_GRAPH<1U>();
+TEST(SpapQueueTest, DivisorsByValueWorkerProcessBatch) {
+    // The default processBatch reaches the by-value override through the virtual table
+    constexpr QNetwork<4, 16> netw = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.processBatchSize_ = processBatchTestWidth;
+        return graph;
+    }();
 
     std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
                                                      std::vector<std::size_t>(divisorTestMaxSize, 0));
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    SpapQueue<std::size_t, netw, ByValueDivisorWorker, BulkDivisorLocalQueueType> globalQ;
     EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
     globalQ.pushBeforeProcessing(1U, 0U);
     globalQ.processQueue();
     globalQ.waitProcessFinish();
 
-    std::vector<std::size_t> solution = computeAnswerDivisors(divisorTestMaxSize);
+    expectDivisorCounts(ansCounter);
+}
 
-    // Tallying up from all workers
-    for (std::size_t i = 1; i < netw.numWorkers_; ++i) {
-        for (std::size_t j = 0; j < divisorTestMaxSize; ++j) { ansCounter[0][j] += ansCounter[i][j]; }
-    }
+TEST(SpapQueueTest, TerminationWrites) {
+    constexpr QNetwork<4, 16> globalCountNetw = FULLY_CONNECTED_GRAPH<4U>();
 
-    for (std::size_t i = 0; i < divisorTestMaxSize; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i]); }
+    std::vector<std::vector<std::size_t>> ansCounter(globalCountNetw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, globalCountNetw, DivisorWorker, DivisorLocalQueueType> globalCountQ;
+    EXPECT_TRUE(globalCountQ.initQueue(std::ref(ansCounter)));
+    globalCountQ.pushBeforeProcessing(1U, 0U);
+    globalCountQ.processQueue();
+    globalCountQ.waitProcessFinish();
+
+    std::size_t numCountUpdates = 0U;
+    for (std::size_t worker = 0U; worker < globalCountNetw.numWorkers_; ++worker) {
+        numCountUpdates += globalCountQ.terminationWrites(worker).countUpdates_;
+        EXPECT_EQ(globalCountQ.terminationWrites(worker).tallyPublishes_, 0U);
+        EXPECT_EQ(globalCountQ.terminationWrites(worker).finishAttempts_, 0U);
+    }
+    EXPECT_GT(numCountUpdates, 0U);
+
+    for (auto &workerCounter : ansCounter) { std::fill(workerCounter.begin(), workerCounter.end(), 0U); }
+
+    SpapQueue<std::size_t, quiescenceNetw, DivisorWorker, DivisorLocalQueueType> quiescenceQ;
+    EXPECT_TRUE(quiescenceQ.initQueue(std::ref(ansCounter)));
+    quiescenceQ.pushBeforeProcessing(1U, 0U);
+    quiescenceQ.processQueue();
+    quiescenceQ.waitProcessFinish();
+
+    std::size_t numTallyPublishes = 0U;
+    std::size_t numFinishAttempts = 0U;
+    for (std::size_t worker = 0U; worker < quiescenceNetw.numWorkers_; ++worker) {
+        EXPECT_EQ(quiescenceQ.terminationWrites(worker).countUpdates_, 0U);
+        numTallyPublishes += quiescenceQ.terminationWrites(worker).tallyPublishes_;
+        numFinishAttempts += quiescenceQ.terminationWrites(worker).finishAttempts_;
+    }
+    EXPECT_GT(numTallyPublishes, 0U);
+    EXPECT_GE(numFinishAttempts, 1U);
 }
 
-TEST(SpapQueueTest, DivisorsHomogeneousWorkers) {
-    constexpr QNetwork<4, 16> netw = FULLY_CONNECTED_GRAPH<4U>();
+TEST(SpapQueueTest, ChainContinuations) {
+    constexpr QNetwork<1, 1> netw = []() {
+        QNetwork<1, 1> graph = FULLY_CONNECTED_GRAPH<1U>();
+        graph.continuations_ = true;
+        return graph;
+    }();
 
-    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
-                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+    std::vector<std::size_t> numProcessed(netw.numWorkers_, 0U);
+    std::vector<std::size_t> numPushes(netw.numWorkers_, 0U);
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
-    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
-    globalQ.pushBeforeProcessing(1U, 0U);
+    SpapQueue<std::size_t, netw, ChainWorker, CountingChainLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(numProcessed), std::ref(numPushes)));
+    globalQ.pushBeforeProcessing(0U, 0U);
     globalQ.processQueue();
     globalQ.waitProcessFinish();
 
-    std::vector<std::size_t> solution = computeAnswerDivisors(divisorTestMaxSize);
+    EXPECT_EQ(numProcessed[0U], chainTestLength);
+    // Only the initial task passes through the local queue
+    EXPECT_EQ(numPushes[0U], 1U);
+}
 
-    // Tallying up from all workers
-    for (std::size_t i = 1; i < netw.numWorkers_; ++i) {
-        for (std::size_t j = 0; j < divisorTestMaxSize; ++j) { ansCounter[0][j] += ansCounter[i][j]; }
-    }
+TEST(SpapQueueTest, ChainContinuationsEnqueueEveryTask) {
+    constexpr QNetwork<1, 1> netw = []() {
+        QNetwork<1, 1> graph = FULLY_CONNECTED_GRAPH<1U>();
+        graph.continuations_ = true;
+        graph.enqueueFrequency_ = 1U;
+        return graph;
+    }();
 
-    for (std::size_t i = 0; i < divisorTestMaxSize; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i]); }
+    std::vector<std::size_t> numProcessed(netw.numWorkers_, 0U);
+    std::vector<std::size_t> numPushes(netw.numWorkers_, 0U);
+
+    SpapQueue<std::size_t, netw, ChainWorker, CountingChainLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(numProcessed), std::ref(numPushes)));
+    globalQ.pushBeforeProcessing(0U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    EXPECT_EQ(numProcessed[0U], chainTestLength);
+    // The incomming channels are checked before every continuation instead of handing it back
+    EXPECT_EQ(numPushes[0U], 1U);
 }
 
-TEST(SpapQueueTest, DivisorsHeterogeneousWorkers) {
-    constexpr QNetwork<2, 3> netw({0, 1, 3}, {1, 0, 1});
+TEST(SpapQueueTest, ChainContinuationsKeepSelfShare) {
+    constexpr QNetwork<2, 4> netw = []() {
+        QNetwork<2, 4> graph({0, 2, 4}, {0, 1, 1, 0}, {0, 1}, {1, 1, 1, 1}, {1, 1, 1, 1});
+        graph.continuations_ = true;
+        graph.idlePolicy_ = IdlePolicy::Yield;
+        return graph;
+    }();
 
-    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
-                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+    std::vector<std::size_t> numProcessed(netw.numWorkers_, 0U);
+    std::vector<std::size_t> numPushes(netw.numWorkers_, 0U);
 
-    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
-    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
-    globalQ.pushBeforeProcessing(1U, 0U);
+    SpapQueue<std::size_t, netw, ChainWorker, CountingChainLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(numProcessed), std::ref(numPushes)));
+    globalQ.pushBeforeProcessing(0U, 0U);
     globalQ.processQueue();
     globalQ.waitProcessFinish();
 
-    std::vector<std::size_t> solution = computeAnswerDivisors(divisorTestMaxSize);
+    EXPECT_EQ(numProcessed[0U] + numProcessed[1U], chainTestLength);
+    // Every other child is kept local, hence the chain alternates between the workers
+    EXPECT_GE(numProcessed[0U], chainTestLength / 4U);
+    EXPECT_GE(numProcessed[1U], chainTestLength / 4U);
+}
 
-    // Tallying up from all workers
-    for (std::size_t i = 1; i < netw.numWorkers_; ++i) {
-        for (std::size_t j = 0; j < divisorTestMaxSize; ++j) { ansCounter[0][j] += ansCounter[i][j]; }
-    }
+TEST(SpapQueueTest, IdleParkStop) {
+    constexpr QNetwork<2, 4> netw = []() {
+        QNetwork<2, 4> graph = FULLY_CONNECTED_GRAPH<2U>();
+        graph.idlePolicy_ = IdlePolicy::Park;
+        return graph;
+    }();
 
-    for (std::size_t i = 0; i < divisorTestMaxSize; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i]); }
+    std::atomic<bool> release{false};
+
+    SpapQueue<std::size_t, netw, BlockingWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(release)));
+    globalQ.pushBeforeProcessing(0U, 0U);
+    globalQ.processQueue();
+
+    // Worker 1 has nothing to do and parks whilst worker 0 is blocked
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    globalQ.requestStop();
+    release.store(true, std::memory_order_release);
+    globalQ.waitProcessFinish();
+
+    EXPECT_GT(globalQ.idleTime(1U), std::chrono::nanoseconds(0));
 }
 
 TEST(SpapQueueTest, DivisorsPushSafeHomogeneousWorkers) {
@@ -455,6 +1451,123 @@ TEST(SpapQueueTest, ReuseQueue2) {
     for (std::size_t i = 0; i < divisorTestMaxSize; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i]); }
 }
 
+TEST(SpapQueueTest, ReusePersistentWorkers) {
+    constexpr QNetwork<4, 16> netw = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.persistentWorkers_ = true;
+        return graph;
+    }();
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    expectDivisorCounts(ansCounter);
+
+    // Stopping a run of the same workers, which may leave tasks behind
+    EXPECT_TRUE(globalQ.initQueue());
+    globalQ.pushBeforeProcessing(1U, 1U);
+    globalQ.processQueue();
+    globalQ.requestStop();
+    globalQ.waitProcessFinish();
+
+    // Clearing counts
+    for (auto &vec : ansCounter) {
+        for (auto &val : vec) { val = 0; }
+    }
+
+    // Restarting Queue on the same workers
+    EXPECT_TRUE(globalQ.initQueue());
+    globalQ.pushBeforeProcessing(1U, 2U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    expectDivisorCounts(ansCounter);
+
+    // Rebuilding the workers with new arguments
+    std::vector<std::vector<std::size_t>> otherAnsCounter(netw.numWorkers_,
+                                                          std::vector<std::size_t>(divisorTestMaxSize, 0));
+    EXPECT_TRUE(globalQ.initQueue(std::ref(otherAnsCounter)));
+    globalQ.pushBeforeProcessing(1U, 3U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    expectDivisorCounts(otherAnsCounter);
+}
+
+TEST(SpapQueueTest, DestructorPersistentWorkers) {
+    constexpr QNetwork<2, 3> netw = []() {
+        QNetwork<2, 3> graph({0, 1, 3}, {1, 0, 1});
+        graph.persistentWorkers_ = true;
+        return graph;
+    }();
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    {
+        SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+        EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+        globalQ.pushBeforeProcessing(1U, 0U);
+        globalQ.processQueue();
+        globalQ.waitProcessFinish();
+    }
+
+    {
+        SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+        EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+        globalQ.pushBeforeProcessing(1U, 0U);
+    }
+
+    {
+        SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+        EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+        globalQ.pushBeforeProcessing(1U, 0U);
+        globalQ.processQueue();
+    }
+}
+
+template <CorePinning pinning>
+void checkCorePinning() {
+    // Logical cores which are unlikely to be available
+    constexpr QNetwork<4, 16> netw = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        for (std::size_t i = 0U; i < graph.numWorkers_; ++i) { graph.logicalCore_[i] = 1000U + i; }
+        graph.corePinning_ = pinning;
+        return graph;
+    }();
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(divisorTestMaxSize, 0));
+
+    SpapQueue<std::size_t, netw, DivisorWorker, DivisorLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+
+    const std::vector<std::size_t> allowed = allowedCpus();
+    for (const std::size_t cpu : globalQ.workerCores()) {
+        if (pinning == CorePinning::Unpinned) {
+            EXPECT_EQ(cpu, UNPINNED_CORE);
+        } else if (cpu != UNPINNED_CORE) {
+            EXPECT_TRUE(std::binary_search(allowed.cbegin(), allowed.cend(), cpu));
+        }
+    }
+
+    globalQ.pushBeforeProcessing(1U, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    expectDivisorCounts(ansCounter);
+}
+
+TEST(SpapQueueTest, DivisorsRemappedCores) { checkCorePinning<CorePinning::Remap>(); }
+
+TEST(SpapQueueTest, DivisorsUnpinned) { checkCorePinning<CorePinning::Unpinned>(); }
+
 TEST(SpapQueueTest, FibonacciSingleWorker) {
     constexpr QNetwork<1, 1> netw = FULLY_CONNECTED_GRAPH<1U>();
 
@@ -521,6 +1634,50 @@ TEST(SpapQueueTest, FibonacciHeterogeneousWorkers) {
     for (std::size_t i = 0; i < fibonacciTestSize + 1; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i]); }
 }
 
+TEST(SpapQueueTest, FibonacciMoveOnlyHomogeneousWorkers) {
+    constexpr QNetwork<4, 16> netw = FULLY_CONNECTED_GRAPH<4U>();
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(fibonacciTestSize + 1, 0));
+
+    SpapQueue<std::unique_ptr<std::size_t>, netw, MoveOnlyFibonacciWorker, MoveOnlyLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(std::make_unique<std::size_t>(fibonacciTestSize), 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    std::vector<std::size_t> solution = computeAnswerFibonacci(fibonacciTestSize + 1);
+
+    // Tallying up from all workers
+    for (std::size_t i = 1; i < netw.numWorkers_; ++i) {
+        for (std::size_t j = 0; j < fibonacciTestSize + 1; ++j) { ansCounter[0][j] += ansCounter[i][j]; }
+    }
+
+    for (std::size_t i = 0; i < fibonacciTestSize + 1; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i]); }
+}
+
+TEST(SpapQueueTest, FibonacciMoveOnlyHeterogeneousWorkers) {
+    constexpr QNetwork<2, 3> netw({0, 1, 3}, {1, 0, 1});
+
+    std::vector<std::vector<std::size_t>> ansCounter(netw.numWorkers_,
+                                                     std::vector<std::size_t>(fibonacciTestSize + 1, 0));
+
+    SpapQueue<std::unique_ptr<std::size_t>, netw, MoveOnlyFibonacciWorker, MoveOnlyLocalQueueType> globalQ;
+    EXPECT_TRUE(globalQ.initQueue(std::ref(ansCounter)));
+    globalQ.pushBeforeProcessing(std::make_unique<std::size_t>(fibonacciTestSize), 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    std::vector<std::size_t> solution = computeAnswerFibonacci(fibonacciTestSize + 1);
+
+    // Tallying up from all workers
+    for (std::size_t i = 1; i < netw.numWorkers_; ++i) {
+        for (std::size_t j = 0; j < fibonacciTestSize + 1; ++j) { ansCounter[0][j] += ansCounter[i][j]; }
+    }
+
+    for (std::size_t i = 0; i < fibonacciTestSize + 1; ++i) { EXPECT_EQ(ansCounter[0][i], solution[i]); }
+}
+
 TEST(SpapQueueTest, SSSPSingleWorker) {
     constexpr QNetwork<1, 1> netw = FULLY_CONNECTED_GRAPH<1U>();
 
@@ -605,6 +1762,52 @@ TEST(SpapQueueTest, SSSPHomogeneousWorkers) {
     }
 }
 
+TEST(SpapQueueTest, SSSPContinuations) {
+    constexpr QNetwork<4, 16> netw = []() {
+        QNetwork<4, 16> graph = FULLY_CONNECTED_GRAPH<4U>();
+        graph.continuations_ = true;
+        return graph;
+    }();
+
+    SpapQueue<std::array<unsigned, 2U>,
+              netw,
+              SSSPWorker,
+              std::priority_queue<std::array<unsigned, 2U>,
+                                  std::vector<std::array<unsigned, 2U>>,
+                                  std::greater<std::array<unsigned, 2U>>>>
+        globalQ;
+
+    const CSRGraph graph = make3DTorus(SSSPTorusSideLength);
+    const unsigned nVerts = SSSPTorusSideLength * SSSPTorusSideLength * SSSPTorusSideLength;
+
+    std::vector<std::atomic<unsigned>> distances(nVerts);
+    for (auto &dist : distances) {
+        dist.store(std::numeric_limits<unsigned>::max(), std::memory_order_relaxed);
+    }
+    distances[0].store(0U, std::memory_order_relaxed);
+
+    EXPECT_TRUE(globalQ.initQueue(std::cref(graph), std::ref(distances)));
+    globalQ.pushBeforeProcessing({0U, 0U}, 0U);
+    globalQ.processQueue();
+    globalQ.waitProcessFinish();
+
+    const unsigned sideLengthSqr = SSSPTorusSideLength * SSSPTorusSideLength;
+
+    for (unsigned i = 0U; i < SSSPTorusSideLength; ++i) {
+        for (unsigned j = 0U; j < SSSPTorusSideLength; ++j) {
+            for (unsigned k = 0U; k < SSSPTorusSideLength; ++k) {
+                const unsigned vert = k + (j * SSSPTorusSideLength) + (i * sideLengthSqr);
+
+                const unsigned dist = std::min(k, SSSPTorusSideLength - k)
+                                      + std::min(j, SSSPTorusSideLength - j)
+                                      + std::min(i, SSSPTorusSideLength - i);
+
+                EXPECT_EQ(distances[vert].load(std::memory_order_relaxed), dist);
+            }
+        }
+    }
+}
+
 TEST(SpapQueueTest, SSSPHeterogeneousWorkers) {
     constexpr QNetwork<2, 3> netw({0, 1, 3}, {1, 0, 1});
 